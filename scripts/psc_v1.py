@@ -1,5 +1,9 @@
 #!/usr/bin/env python3
-"""Small structural validator for PolarShader PSC v1 scene files."""
+"""Small structural validator for PolarShader PSC scene files.
+
+Validates single-layer v1 files and layered v2 files (see
+src/composer/SceneCodec.h); the module keeps its v1 name for existing imports.
+"""
 
 from __future__ import annotations
 
@@ -8,6 +12,9 @@ from dataclasses import dataclass
 
 MAGIC = b"PSC\0"
 VERSION = 1
+LAYERED_VERSION = 2
+MAX_LAYERS = 4  # POLAR_SHADER_PSC_MAX_LAYERS default
+BLEND_MODE_COUNT = 4  # Normal, Add, Multiply, Screen
 MAX_RECURSION_DEPTH = 64
 PALETTE_IDS = frozenset({0, 1, 2, 3})
 
@@ -18,7 +25,9 @@ class PscValidationError(ValueError):
 
 @dataclass(frozen=True)
 class PscInfo:
+    # Bottom layer's pattern tag for layered scenes.
     pattern_tag: int
+    layer_count: int = 1
 
 
 class _Reader:
@@ -262,20 +271,12 @@ def _read_transform(reader: _Reader) -> tuple[int, str]:
 def raw_pattern_tag(data: bytes) -> int | None:
     if len(data) >= 7 and data[:4] == MAGIC and data[4] == VERSION:
         return data[6]
+    if len(data) >= 11 and data[:4] == MAGIC and data[4] == LAYERED_VERSION:
+        return data[10]
     return None
 
 
-def validate_psc_scene(data: bytes) -> PscInfo:
-    reader = _Reader(data)
-    if reader.remaining < len(MAGIC):
-        raise PscValidationError(f".psc file is too short ({reader.remaining} bytes)")
-    if bytes(reader.u8() for _ in range(4)) != MAGIC:
-        raise PscValidationError("bad .psc magic")
-
-    version = reader.u8()
-    if version != VERSION:
-        raise PscValidationError(f"unsupported .psc version {version}")
-
+def _read_layer(reader: _Reader) -> int:
     palette_id = reader.u8()
     if palette_id not in PALETTE_IDS:
         raise PscValidationError(f"unknown palette id {palette_id}")
@@ -288,6 +289,34 @@ def validate_psc_scene(data: bytes) -> PscInfo:
             raise PscValidationError(
                 f"transform tag 0x{transform_tag:02x} is not compatible with raster pattern 0x{pattern_tag:02x}"
             )
+    return pattern_tag
+
+
+def validate_psc_scene(data: bytes) -> PscInfo:
+    reader = _Reader(data)
+    if reader.remaining < len(MAGIC):
+        raise PscValidationError(f".psc file is too short ({reader.remaining} bytes)")
+    if bytes(reader.u8() for _ in range(4)) != MAGIC:
+        raise PscValidationError("bad .psc magic")
+
+    version = reader.u8()
+    if version == VERSION:
+        pattern_tag = _read_layer(reader)
+        reader.expect_end("scene")
+        return PscInfo(pattern_tag=pattern_tag)
+    if version != LAYERED_VERSION:
+        raise PscValidationError(f"unsupported .psc version {version}")
+
+    layer_count = reader.u8()
+    if not 1 <= layer_count <= MAX_LAYERS:
+        raise PscValidationError(f"layer count {layer_count} outside 1..{MAX_LAYERS}")
+    pattern_tags = []
+    for _ in range(layer_count):
+        reader.u16()  # alpha (u0x16)
+        blend_mode = reader.u8()
+        if blend_mode >= BLEND_MODE_COUNT:
+            raise PscValidationError(f"bad blend mode {blend_mode}")
+        pattern_tags.append(_read_layer(reader))
 
     reader.expect_end("scene")
-    return PscInfo(pattern_tag=pattern_tag)
+    return PscInfo(pattern_tag=pattern_tags[0], layer_count=layer_count)
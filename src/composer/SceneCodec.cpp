@@ -18,7 +18,7 @@
  * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
  */
 
-// PSC v1 wire-format decoder. See SceneCodec.h for the format spec.
+// PSC v1/v2 wire-format decoder. See SceneCodec.h for the format spec.
 //
 // Tag tables in this file MUST match web/sketches/composer/schema.js
 // byte-for-byte. The cross-implementation golden fixture in test_composer
@@ -1067,6 +1067,57 @@ namespace PolarShader::composer {
             return ok;
         }
 
+        // ───── Layer decoder ───────────────────────────────────────────
+
+        constexpr uint8_t kVersionSingleLayer = 1;
+        constexpr uint8_t kVersionLayered = 2;
+
+        // Decodes palette id + pattern + transform list into a layer; v2
+        // prefixes each one with alpha and blend mode. Returns nullptr on
+        // failure with *status set.
+        std::shared_ptr<Layer> decodeLayer(ByteReader &r,
+                                           DecodeStatus *status,
+                                           uint8_t version) {
+            u0x16 alpha(0xFFFFu);
+            BlendMode blendMode = BlendMode::Normal;
+            if (version == kVersionLayered) {
+                uint16_t alphaRaw = r.readU16();
+                uint8_t blendByte = r.readU8();
+                if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); return nullptr; }
+                if (blendByte > static_cast<uint8_t>(BlendMode::Screen)) {
+                    setStatusIfOk(status, DecodeStatus::BAD_ENUM); return nullptr;
+                }
+                alpha = u0x16(alphaRaw);
+                blendMode = static_cast<BlendMode>(blendByte);
+            }
+
+            // Palette
+            uint8_t paletteId = r.readU8();
+            if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); return nullptr; }
+            const ::CRGBPalette16 *palette = paletteById(paletteId);
+            if (!palette) { setStatusIfOk(status, DecodeStatus::BAD_ENUM); return nullptr; }
+
+            // Pattern
+            std::unique_ptr<UVPattern> pattern = decodePattern(r, status, version);
+            if (*status != DecodeStatus::OK || !pattern) return nullptr;
+
+            const bool allowUvTransforms = pattern->domain() != PatternDomain::RasterGrid;
+            LayerBuilder builder(std::move(pattern), *palette, "composer");
+            // Palette id 0 is Rainbow; a hue-remap onto it is redundant, so colour
+            // patterns render their emitted hue natively instead.
+            builder.setPaletteIsRainbow(paletteId == 0);
+            builder.setAlpha(alpha);
+            builder.setBlendMode(blendMode);
+
+            // Transforms
+            uint8_t transformCount = r.readU8();
+            if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); return nullptr; }
+            for (uint8_t i = 0; i < transformCount; ++i) {
+                if (!decodeTransform(r, builder, status, allowUvTransforms, version)) return nullptr;
+            }
+            return std::make_shared<Layer>(builder.build());
+        }
+
     } // namespace (anonymous)
 
     std::unique_ptr<Scene> decodeSceneWithDuration(const uint8_t *bytes,
@@ -1089,20 +1140,22 @@ namespace PolarShader::composer {
         // Version
         uint8_t version = r.readU8();
         if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); if (statusOut) *statusOut = *status; return nullptr; }
-        if (version != 1) {
+        if (version != kVersionSingleLayer && version != kVersionLayered) {
             setStatusIfOk(status, DecodeStatus::BAD_VERSION);
             if (statusOut) *statusOut = *status;
             return nullptr;
         }
 
-        // Palette
-        uint8_t paletteId = r.readU8();
-        if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); if (statusOut) *statusOut = *status; return nullptr; }
-        const ::CRGBPalette16 *palette = paletteById(paletteId);
-        if (!palette) {
-            setStatusIfOk(status, DecodeStatus::BAD_ENUM);
-            if (statusOut) *statusOut = *status;
-            return nullptr;
+        // Layer count: implicit in v1, explicit in v2.
+        uint8_t layerCount = 1;
+        if (version == kVersionLayered) {
+            layerCount = r.readU8();
+            if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); if (statusOut) *statusOut = *status; return nullptr; }
+            if (layerCount == 0 || layerCount > POLAR_SHADER_PSC_MAX_LAYERS) {
+                setStatusIfOk(status, DecodeStatus::BAD_VALUE);
+                if (statusOut) *statusOut = *status;
+                return nullptr;
+            }
         }
 
         // Looping mode is signalled by a finite scene duration; propagate it to
@@ -1110,27 +1163,14 @@ namespace PolarShader::composer {
         // (live playback via decodeScene) keeps signals free-running.
         g_signalLoopPeriodMs = (durationMs == UINT32_MAX) ? 0 : durationMs;
 
-        // Pattern
-        std::unique_ptr<UVPattern> pattern = decodePattern(r, status, version);
-        if (*status != DecodeStatus::OK || !pattern) {
-            if (statusOut) *statusOut = *status;
-            return nullptr;
-        }
-
-        const bool allowUvTransforms = pattern->domain() != PatternDomain::RasterGrid;
-        LayerBuilder builder(std::move(pattern), *palette, "composer");
-        // Palette id 0 is Rainbow; a hue-remap onto it is redundant, so colour
-        // patterns render their emitted hue natively instead.
-        builder.setPaletteIsRainbow(paletteId == 0);
-
-        // Transforms
-        uint8_t transformCount = r.readU8();
-        if (!r.ok()) { setStatusIfOk(status, DecodeStatus::TRUNCATED); if (statusOut) *statusOut = *status; return nullptr; }
-        for (uint8_t i = 0; i < transformCount; ++i) {
-            if (!decodeTransform(r, builder, status, allowUvTransforms, version)) {
+        fl::vector<std::shared_ptr<Layer>> layers;
+        for (uint8_t i = 0; i < layerCount; ++i) {
+            std::shared_ptr<Layer> layer = decodeLayer(r, status, version);
+            if (!layer) {
                 if (statusOut) *statusOut = *status;
                 return nullptr;
             }
+            layers.push_back(std::move(layer));
         }
 
         if (!r.atEnd()) {
@@ -1139,9 +1179,6 @@ namespace PolarShader::composer {
             return nullptr;
         }
 
-        fl::vector<std::shared_ptr<Layer>> layers;
-        layers.push_back(std::make_shared<Layer>(builder.build()));
-
         if (statusOut) *statusOut = DecodeStatus::OK;
         return std::make_unique<Scene>(std::move(layers), durationMs);
     }
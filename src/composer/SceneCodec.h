@@ -26,8 +26,15 @@
 #include <memory>
 #include "renderer/scene/Scene.h"
 
+// Most layers a v2 scene may carry. Each layer compiles its own sampler
+// chain, so this bounds decode memory on the MCU; the web codec and
+// scripts/psc_v1.py enforce the same default.
+#ifndef POLAR_SHADER_PSC_MAX_LAYERS
+#define POLAR_SHADER_PSC_MAX_LAYERS 4
+#endif
+
 namespace PolarShader::composer {
-    // Wire format:
+    // Wire format (v1, single layer):
     //
     //   offset  size  field
     //   ─────── ────  ──────────────────────────────────────────────
@@ -40,6 +47,16 @@ namespace PolarShader::composer {
     //   …       1     transform_n  transform count
     //   …       …     transform[i] tag(1) + length(2) + static-config + signal slots
     //
+    // v2 (layered) keeps the magic, then:
+    //
+    //   4       1     version      0x02
+    //   5       1     layer_n      1..POLAR_SHADER_PSC_MAX_LAYERS, bottom first
+    //   …             layer[i]     alpha(2, u0x16) + blend_mode(1) + palette_id(1)
+    //                              + pattern record + transform_n + transforms,
+    //                              each as in v1
+    //
+    // blend_mode indexes BlendMode: 0 Normal, 1 Add, 2 Multiply, 3 Screen.
+    //
     // A Signal blob is recursive: signal_tag(1) + body_len(2) + body.
     //
     // Little-endian throughout. The format is display-agnostic — nothing
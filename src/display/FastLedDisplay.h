@@ -23,6 +23,9 @@
 
 #include "FastLED.h"
 #include <renderer/PolarRenderer.h>
+#include "renderer/profiling/FrameProfiler.h"
+#include "renderer/profiling/QualityGovernor.h"
+#include <cstring>
 #include <type_traits>
 #include "display/DisplayEntropy.h"
 #include "PolarDisplaySpec.h"
@@ -31,19 +34,79 @@
 #include <pico/sync.h>
 #endif
 
+// Dual-core RP2040 only: Core 1 renders frame N+1 into a back buffer while
+// Core 0 clocks frame N out with FastLED.show(). Shown frames lag the render
+// clock by one refresh period; costs a second LED buffer.
+#ifndef POLAR_SHADER_FASTLED_PIPELINED_SHOW
+#define POLAR_SHADER_FASTLED_PIPELINED_SHOW 1
+#endif
+
+// Dual-core RP2040 only: 1 shares each frame between the cores through
+// PolarRenderer::renderChunks(); 0 uses the fixed even/odd pixel split.
+#ifndef POLAR_SHADER_RP2040_WORK_STEALING
+#define POLAR_SHADER_RP2040_WORK_STEALING 1
+#endif
+
 namespace PolarShader {
+    struct CoreRenderStats {
+        uint32_t micros{0}; // time spent rendering the last frame
+        uint16_t pixels{0}; // pixels rendered in the last frame
+    };
+
     template<typename SPEC>
     class FastLedDisplay {
         static_assert(std::is_base_of<PolarDisplaySpec, SPEC>::value, "SPEC must derive from PolarDisplaySpec");
         PolarRenderer renderer;
         CRGB *outputArray;
         uint8_t refreshRateInMillis;
+#if POLAR_SHADER_QUALITY_GOVERNOR
+        QualityGovernor qualityGovernor;
+#endif
 
 #ifdef RP2040_ENABLED
         bool dualCore{false};
         semaphore_t startSem; // Core 0 releases to start Core 1's render
         semaphore_t doneSem; // Core 1 releases when its render is done
+        CRGB *backArray{nullptr}; // Core 1's render target in pipelined mode
+        bool frameInFlight{false}; // Core 1 owes a frame in backArray
+        CoreRenderStats coreStats[2]; // each entry is written by its own core only
+
+        // Renders this core's share of the current frame into `target`.
+        void renderShare(CRGB *target, uint8_t coreIndex) {
+            const uint32_t startMicros = micros();
+            uint16_t pixels;
+            if (POLAR_SHADER_RP2040_WORK_STEALING) {
+                pixels = renderer.renderChunks(target, coreIndex);
+            } else if (backArray) {
+                renderer.renderSlice(target, 0, 1, coreIndex); // whole frame
+                pixels = renderer.nbLeds;
+            } else {
+                renderer.renderSlice(target, coreIndex, 2, coreIndex); // even/odd pixels
+                pixels = static_cast<uint16_t>((renderer.nbLeds + 1 - coreIndex) / 2);
+            }
+            coreStats[coreIndex] = CoreRenderStats{micros() - startMicros, pixels};
+        }
+#endif
+
+        // Feeds a frame's time to the governor; the new quality applies from
+        // the next prepareFrame().
+        void governFrame(uint32_t frameMicros) {
+#if POLAR_SHADER_QUALITY_GOVERNOR
+            renderer.setQuality(qualityGovernor.recordFrame(frameMicros));
+#else
+            (void)frameMicros;
 #endif
+        }
+
+        void showFrame() {
+            {
+                POLAR_SHADER_PROFILE_SCOPE(ProfileStage::Show, "FastLED");
+                FastLED.show();
+            }
+#if POLAR_SHADER_PROFILE
+            if (FrameProfiler::endFrame()) FrameProfiler::printReport(Serial);
+#endif
+        }
 
     public:
         explicit FastLedDisplay(
@@ -53,7 +116,11 @@ namespace PolarShader {
             bool dualCore = false
         ) : renderer(spec.nbLeds(), [pSpec = &spec](uint16_t pixelIndex) { return pSpec->toRenderPoint(pixelIndex); }),
             outputArray(new CRGB[spec.nbLeds()]),
-            refreshRateInMillis(refreshRateInMillis) {
+            refreshRateInMillis(refreshRateInMillis)
+#if POLAR_SHADER_QUALITY_GOVERNOR
+            , qualityGovernor(static_cast<uint32_t>(refreshRateInMillis) * 1000u)
+#endif
+        {
             DisplayEntropy::addFloatingPinEntropy(
                 DisplayEntropy::kXiaoFloatingPins,
                 SPEC::LED_PIN
@@ -71,17 +138,44 @@ namespace PolarShader {
             if (dualCore) {
                 sem_init(&startSem, 0, 1); // 0 initial permits: Core 1 starts blocked
                 sem_init(&doneSem, 0, 1); // 0 initial permits: Core 0 starts blocked
+                if (POLAR_SHADER_FASTLED_PIPELINED_SHOW) {
+                    backArray = new CRGB[spec.nbLeds()];
+                }
             }
 #endif
         }
 
         void loop() {
             EVERY_N_MILLISECONDS(refreshRateInMillis) {
+#ifdef RP2040_ENABLED
+                if (backArray) {
+                    if (frameInFlight) {
+                        sem_acquire_blocking(&doneSem); // wait for Core 1's frame
+                        memcpy(outputArray, backArray, sizeof(CRGB) * renderer.nbLeds);
+                        // Show overlaps the render here, so only the slower
+                        // core's share counts against the refresh period.
+                        const uint32_t core0 = coreStats[0].micros;
+                        const uint32_t core1 = coreStats[1].micros;
+                        governFrame(core0 > core1 ? core0 : core1);
+                    }
+                    // Core 1 is idle, so the scene can advance before it
+                    // starts on the next frame while this one is shown.
+                    renderer.prepareFrame(millis());
+                    sem_release(&startSem); // wake Core 1
+                    frameInFlight = true;
+                    showFrame();
+                    // Pick up whatever chunks of the next frame Core 1 has
+                    // not claimed yet.
+                    if (POLAR_SHADER_RP2040_WORK_STEALING) renderShare(backArray, 0);
+                    return;
+                }
+#endif
+                const uint32_t startMicros = micros();
 #ifdef RP2040_ENABLED
                 if (dualCore) {
                     renderer.prepareFrame(millis());
                     sem_release(&startSem); // wake Core 1
-                    renderer.renderSlice(outputArray, 0, 2, 0); // even pixels
+                    renderShare(outputArray, 0);
                     sem_acquire_blocking(&doneSem); // wait for Core 1
                 } else {
                     renderer.render(outputArray, millis());
@@ -89,22 +183,37 @@ namespace PolarShader {
 #else
                 renderer.render(outputArray, millis());
 #endif
-                FastLED.show();
+                showFrame();
+                governFrame(micros() - startMicros);
+                return;
             }
+            // Idle between frames: decode the next playlist scene now rather
+            // than inside the frame where the current one expires.
+            renderer.prefetchNextScene(millis());
         }
 
 #ifdef RP2040_ENABLED
         // Called from loop1() on Core 1. Blocks until Core 0 signals a new frame,
-        // renders odd pixels, then signals completion.
+        // renders its share (odd pixels, claimed chunks, or the whole next
+        // frame in pipelined stride mode), then signals completion.
         void core1Loop() {
             if (!dualCore) return;
             sem_acquire_blocking(&startSem); // wait for Core 0
-            renderer.renderSlice(outputArray, 1, 2, 1); // odd pixels
+            renderShare(backArray ? backArray : outputArray, 1);
             sem_release(&doneSem); // signal Core 0 done
         }
+
+        // Render time and pixel count of each core's share of the last
+        // frame, for checking how evenly the work is balanced.
+        const CoreRenderStats &getCoreRenderStats(uint8_t coreIndex) const {
+            return coreStats[coreIndex == 0 ? 0 : 1];
+        }
 #endif
 
         ~FastLedDisplay() {
+#ifdef RP2040_ENABLED
+            delete[] backArray;
+#endif
             delete[] outputArray;
         }
     };
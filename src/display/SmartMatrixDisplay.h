@@ -24,6 +24,7 @@
 #include "FastLED.h"
 #include "MatrixDisplaySpec.h"
 #include "renderer/PolarRenderer.h"
+#include "renderer/profiling/QualityGovernor.h"
 
 namespace PolarShader {
     class SmartMatrixDisplay {
@@ -31,6 +32,9 @@ namespace PolarShader {
         PolarRenderer renderer;
         CRGB *outputArray;
         uint8_t refreshRateInMillis;
+#if POLAR_SHADER_QUALITY_GOVERNOR
+        QualityGovernor qualityGovernor;
+#endif
 
     public:
         explicit SmartMatrixDisplay(
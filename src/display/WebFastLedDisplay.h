@@ -38,6 +38,7 @@
 #include "PolarDisplaySpec.h"
 #include "WebDisplayGeometry.h"
 #include "renderer/PolarRenderer.h"
+#include "renderer/profiling/FrameProfiler.h"
 
 namespace PolarShader {
     template<typename SPEC>
@@ -80,6 +81,8 @@ namespace PolarShader {
             FastLED.show();
         }
 
+        uint16_t nbLeds() const { return renderer.nbLeds; }
+
         void loop() {
             EVERY_N_MILLISECONDS(refreshRateInMillis) {
                 renderNow();
@@ -108,7 +111,14 @@ namespace PolarShader {
 
         void renderNow() {
             renderer.render(outputArray.data(), millis());
-            FastLED.show();
+            {
+                POLAR_SHADER_PROFILE_SCOPE(ProfileStage::Show, "FastLED");
+                FastLED.show();
+            }
+#if POLAR_SHADER_PROFILE
+            // Reports are pulled by the composer; see composer_profile_report().
+            FrameProfiler::endFrame();
+#endif
         }
     };
 }
@@ -20,6 +20,7 @@
 
 #include "display/SmartMatrixDisplay.h"
 #include "display/DisplayEntropy.h"
+#include "renderer/profiling/FrameProfiler.h"
 
 #ifdef SMARTMATRIX_ENABLED
 
@@ -67,7 +68,11 @@ namespace PolarShader {
     ) : spec(spec),
         renderer(spec.nbLeds(), [&spec](uint16_t pixelIndex) { return spec.toRenderPoint(pixelIndex); }),
         outputArray(new CRGB[spec.nbLeds()]),
-        refreshRateInMillis(refreshRateInMillis) {
+        refreshRateInMillis(refreshRateInMillis)
+#if POLAR_SHADER_QUALITY_GOVERNOR
+        , qualityGovernor(static_cast<uint32_t>(refreshRateInMillis) * 1000u)
+#endif
+    {
         DisplayEntropy::addFloatingPinEntropy(DisplayEntropy::kTeensySmartMatrixFloatingPins);
 
         matrix.addLayer(&backgroundLayer);
@@ -81,6 +86,9 @@ namespace PolarShader {
 
     void SmartMatrixDisplay::loop() {
         EVERY_N_MILLISECONDS(refreshRateInMillis) {
+#if POLAR_SHADER_QUALITY_GOVERNOR
+            const uint32_t startMicros = micros();
+#endif
             renderer.render(outputArray, millis());
 
             auto *buffer = backgroundLayer.backBuffer();
@@ -102,8 +110,21 @@ namespace PolarShader {
                 }
             }
 
-            backgroundLayer.swapBuffers(false);
+            {
+                POLAR_SHADER_PROFILE_SCOPE(ProfileStage::Show, "SmartMatrix");
+                backgroundLayer.swapBuffers(false);
+            }
+#if POLAR_SHADER_QUALITY_GOVERNOR
+            renderer.setQuality(qualityGovernor.recordFrame(micros() - startMicros));
+#endif
+#if POLAR_SHADER_PROFILE
+            if (FrameProfiler::endFrame()) FrameProfiler::printReport(Serial);
+#endif
+            return;
         }
+        // Idle between frames: decode the next playlist scene now rather than
+        // inside the frame where the current one expires.
+        renderer.prefetchNextScene(millis());
     }
 
     SmartMatrixDisplay::~SmartMatrixDisplay() {
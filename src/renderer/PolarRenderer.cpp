@@ -24,6 +24,8 @@
 #include <renderer/pipeline/patterns/Patterns.h>
 #include <renderer/scene/SceneManager.h>
 #include <renderer/layer/Layer.h>
+#include <renderer/pipeline/maths/PolarMaths.h>
+#include <renderer/profiling/OpCounter.h>
 
 #if __has_include("PscPlaylistConfig.h")
 #include "PscPlaylistConfig.h"
@@ -82,11 +84,56 @@ namespace PolarShader {
             }
             precomputedPoints.push_back(point);
         }
+#if POLAR_SHADER_CARTESIAN_UV_CACHE
+        precomputedCartesian.reserve(nbLeds);
+        for (const RenderPoint &point: precomputedPoints) {
+            precomputedCartesian.push_back(polarToCartesianUV(point));
+        }
+#endif
+#if POLAR_SHADER_COARSE_RENDER
+        if (rasterDisplay.valid && rasterDisplay.cellCount <= nbLeds) {
+            rasterCellPixels.assign(rasterDisplay.cellCount, UINT16_MAX);
+            uint32_t mapped = 0;
+            for (uint16_t i = 0; i < nbLeds; ++i) {
+                const RasterPoint &raster = precomputedPoints[i].raster;
+                if (!raster.valid || raster.x >= rasterDisplay.width || raster.y >= rasterDisplay.height) continue;
+                uint16_t &cell = rasterCellPixels[static_cast<uint32_t>(raster.y) * rasterDisplay.width + raster.x];
+                if (cell == UINT16_MAX) ++mapped;
+                cell = i;
+            }
+            if (mapped != rasterDisplay.cellCount) rasterCellPixels.clear();
+        }
+#endif
         sceneManager.setRasterDisplayInfo(rasterDisplay);
     }
 
+    void PolarRenderer::setSceneTransition(const SceneTransition &transition) {
+        sceneManager.setTransition(transition);
+    }
+
     void PolarRenderer::prepareFrame(TimeMillis timeInMillis) {
+        POLAR_SHADER_COUNT_OPS_BEGIN_FRAME();
         sceneManager.advanceFrame(timeInMillis);
+        DisplayPixels pixels;
+        pixels.points = precomputedPoints.data();
+#if POLAR_SHADER_CARTESIAN_UV_CACHE
+        pixels.cartesian = precomputedCartesian.data();
+#endif
+        pixels.count = nbLeds;
+#if POLAR_SHADER_COARSE_RENDER
+        if (!rasterCellPixels.empty()) {
+            pixels.cellPixel = rasterCellPixels.data();
+            pixels.width = rasterDisplay.width;
+            pixels.height = rasterDisplay.height;
+        }
+#endif
+        sceneManager.prepareRender(pixels);
+        nextChunk.store(0, std::memory_order_relaxed);
+        POLAR_SHADER_COUNT_OPS_BEGIN_RENDER();
+    }
+
+    bool PolarRenderer::prefetchNextScene(TimeMillis timeInMillis) {
+        return sceneManager.prefetchNextScene(timeInMillis);
     }
 
     void PolarRenderer::replaceScene(std::unique_ptr<Scene> scene, TimeMillis currentTimeMs) {
@@ -111,8 +158,68 @@ namespace PolarShader {
         uint16_t stride,
         uint8_t coreIndex
     ) const {
-        for (uint16_t i = start; i < nbLeds; i += stride) {
-            outputArray[i] = sceneManager.sample(coreIndex, precomputedPoints[i]);
+        if (start >= nbLeds) return;
+#if POLAR_SHADER_CARTESIAN_UV_CACHE
+        const UV *cartesian = precomputedCartesian.data();
+#else
+        const UV *cartesian = nullptr;
+#endif
+        if (stride <= 1) {
+            sceneManager.sampleSpan(
+                coreIndex,
+                precomputedPoints.data() + start,
+                cartesian ? cartesian + start : nullptr,
+                outputArray + start,
+                nbLeds - start
+            );
+            return;
+        }
+
+        // Strided slices are gathered into contiguous batches so the scene
+        // still samples whole spans, then scattered back to their pixels.
+        RenderPoint points[SPAN_CHUNK_SIZE];
+        UV uvs[SPAN_CHUNK_SIZE];
+        CRGB colours[SPAN_CHUNK_SIZE];
+        uint32_t i = start;
+        while (i < nbLeds) {
+            uint16_t n = 0;
+            for (uint32_t j = i; j < nbLeds && n < SPAN_CHUNK_SIZE; j += stride) {
+                points[n] = precomputedPoints[j];
+                if (cartesian) uvs[n] = cartesian[j];
+                ++n;
+            }
+            sceneManager.sampleSpan(coreIndex, points, cartesian ? uvs : nullptr, colours, n);
+            for (uint16_t k = 0; k < n; ++k, i += stride) {
+                outputArray[i] = colours[k];
+            }
+        }
+    }
+
+    uint16_t PolarRenderer::renderChunks(CRGB *outputArray, uint8_t coreIndex) const {
+#if POLAR_SHADER_CARTESIAN_UV_CACHE
+        const UV *cartesian = precomputedCartesian.data();
+#else
+        const UV *cartesian = nullptr;
+#endif
+        uint16_t rendered = 0;
+        for (;;) {
+            const uint32_t start =
+                    static_cast<uint32_t>(nextChunk.fetch_add(1, std::memory_order_relaxed)) *
+                    POLAR_SHADER_RENDER_CHUNK_PIXELS;
+            if (start >= nbLeds) break;
+            const uint32_t remaining = nbLeds - start;
+            const uint16_t n = static_cast<uint16_t>(
+                remaining < POLAR_SHADER_RENDER_CHUNK_PIXELS ? remaining : POLAR_SHADER_RENDER_CHUNK_PIXELS
+            );
+            sceneManager.sampleSpan(
+                coreIndex,
+                precomputedPoints.data() + start,
+                cartesian ? cartesian + start : nullptr,
+                outputArray + start,
+                n
+            );
+            rendered = static_cast<uint16_t>(rendered + n);
         }
+        return rendered;
     }
 }
@@ -23,6 +23,20 @@
 
 #include "renderer/RenderPoint.h"
 #include "renderer/scene/SceneManager.h"
+#include <atomic>
+
+// Caches each pixel's Cartesian UV at construction so UV layers skip the
+// per-frame polarToCartesianUV conversion. Costs 8 bytes per LED; set to 0 on
+// targets where RAM matters more than the sin/cos lookups.
+#ifndef POLAR_SHADER_CARTESIAN_UV_CACHE
+#define POLAR_SHADER_CARTESIAN_UV_CACHE 1
+#endif
+
+// Contiguous pixels handed out per claim by renderChunks(). Smaller chunks
+// balance uneven scenes better at the cost of more atomic claims.
+#ifndef POLAR_SHADER_RENDER_CHUNK_PIXELS
+#define POLAR_SHADER_RENDER_CHUNK_PIXELS 32u
+#endif
 
 namespace PolarShader {
     using RenderPointMapper = fl::function<RenderPoint(uint16_t pixelIndex)>;
@@ -32,8 +46,20 @@ namespace PolarShader {
      */
     class PolarRenderer {
         fl::vector<RenderPoint> precomputedPoints;
+#if POLAR_SHADER_CARTESIAN_UV_CACHE
+        // Structure-of-arrays companion to precomputedPoints: the Cartesian UV
+        // of each point, fixed for the lifetime of the display geometry.
+        fl::vector<UV> precomputedCartesian;
+#endif
         RasterDisplayInfo rasterDisplay{};
+#if POLAR_SHADER_COARSE_RENDER
+        // Pixel index of each raster cell, for layers rendered on a coarse
+        // grid. Empty unless every cell of the raster has a pixel.
+        fl::vector<uint16_t> rasterCellPixels;
+#endif
         SceneManager sceneManager;
+        // Next unclaimed chunk of the frame; reset by prepareFrame().
+        mutable std::atomic<uint16_t> nextChunk{0};
 
     public:
         const uint16_t nbLeds;
@@ -60,14 +86,32 @@ namespace PolarShader {
 
         void replaceScenePreservingElapsed(std::unique_ptr<Scene> scene);
 
+        // Pass-through to SceneManager::setTransition.
+        void setSceneTransition(const SceneTransition &transition);
+
+        // Pass-through to SceneManager::setQuality; takes effect at the next
+        // prepareFrame().
+        void setQuality(u0x16 quality) { sceneManager.setQuality(quality); }
+
         void prepareFrame(TimeMillis timeInMillis);
 
+        // Pass-through to SceneManager::prefetchNextScene. Call from the
+        // display loop between frames, on the core that calls prepareFrame.
+        bool prefetchNextScene(TimeMillis timeInMillis);
+
         void renderSlice(
             CRGB *outputArray,
             uint16_t start,
             uint16_t stride,
             uint8_t coreIndex
         ) const;
+
+        // Dynamic alternative to renderSlice(): claims chunks of
+        // POLAR_SHADER_RENDER_CHUNK_PIXELS contiguous pixels from a shared
+        // counter until the frame is exhausted, so each core renders as much
+        // as its share of the scene's cost allows. Both cores call it for the
+        // same frame after prepareFrame(). Returns the pixels this call rendered.
+        uint16_t renderChunks(CRGB *outputArray, uint8_t coreIndex) const;
     };
 } // namespace PolarShader
 
@@ -34,6 +34,33 @@
 #include "renderer/pipeline/transforms/base/Layers.h"
 #include <memory>
 
+// Layers may be sampled on a coarse raster grid and bilinearly upsampled
+// (see Layer::renderDivisor). 0 always renders every pixel.
+#ifndef POLAR_SHADER_COARSE_RENDER
+#define POLAR_SHADER_COARSE_RENDER 1
+#endif
+
+// Smallest raster on which a pattern's declared bandwidth is used
+// automatically; explicit LayerBuilder::setRenderDivisor() applies anywhere.
+#ifndef POLAR_SHADER_COARSE_RENDER_AUTO_MIN_CELLS
+#define POLAR_SHADER_COARSE_RENDER_AUTO_MIN_CELLS 4096u
+#endif
+
+#ifndef POLAR_SHADER_COARSE_RENDER_MAX_DIVISOR
+#define POLAR_SHADER_COARSE_RENDER_MAX_DIVISOR 8u
+#endif
+
+// Upper bound of an adaptive frame divisor (LayerBuilder::setFrameDivisor(0)).
+#ifndef POLAR_SHADER_FRAME_SKIP_MAX
+#define POLAR_SHADER_FRAME_SKIP_MAX 4u
+#endif
+
+// Mean |dR|+|dG|+|dB| a skipped pixel may drift before its refresh; an
+// adaptive layer skips fewer frames above it and more below half of it.
+#ifndef POLAR_SHADER_FRAME_SKIP_TOLERANCE
+#define POLAR_SHADER_FRAME_SKIP_TOLERANCE 8u
+#endif
+
 namespace PolarShader {
     enum class BlendMode {
         Normal,
@@ -59,8 +86,14 @@ namespace PolarShader {
         
         u0x16 alpha{0xFFFFu};
         BlendMode blendMode{BlendMode::Normal};
+        // Raster divisor requested by the preset; 0 picks one from the
+        // pattern's declared bandwidth.
+        uint8_t renderDivisorSetting{0};
+        // Frames between refreshes of each pixel; 0 adapts to the output's
+        // measured rate of change.
+        uint8_t frameDivisor{1};
 
-        static std::unique_ptr<ColourMap> blackLayer(const char *reason);
+        static std::unique_ptr<ColourSpanMap> blackLayer(const char *reason);
 
         static uint16_t computeClipMask(
             const std::shared_ptr<PipelineContext> &context,
@@ -92,7 +125,9 @@ namespace PolarShader {
             const char *name,
             std::shared_ptr<PipelineContext> context,
             u0x16 alpha = u0x16(0xFFFFu),
-            BlendMode blendMode = BlendMode::Normal
+            BlendMode blendMode = BlendMode::Normal,
+            uint8_t renderDivisor = 0,
+            uint8_t frameDivisor = 1
         );
 
         friend class LayerBuilder;
@@ -100,12 +135,50 @@ namespace PolarShader {
     public:
         void setRasterDisplayInfo(const RasterDisplayInfo &rasterDisplay);
 
+        void setQuality(u0x16 quality);
+
         void advanceFrame(u0x16 progress, TimeMillis elapsedMs);
 
+        /**
+         * @brief Compiles the layer into a span sampler.
+         *
+         * This is the render path: every stage of the chain runs once per
+         * batch of up to SPAN_CHUNK_SIZE points instead of once per pixel.
+         */
+        std::unique_ptr<ColourSpanMap> compileSpan() const;
+
+        /** @brief Per-pixel convenience wrapper over compileSpan(). */
         std::unique_ptr<ColourMap> compile() const;
 
         const char *getName() const { return name; }
 
+        // Raster samplers keep a per-cell colour cache, so each sampling core
+        // gets its own. Scene::compile only asks for the second copy when two
+        // cores sample (POLAR_SHADER_SAMPLING_CORES); single-core boards keep one.
+        bool needsPerCoreSampler() const {
+            return pattern && (pattern->needsPerCoreSampler() || pattern->domain() == PatternDomain::RasterGrid);
+        }
+
+        /**
+         * @brief Raster divisor this layer is rendered at on `rasterDisplay`.
+         *
+         * 1 samples every pixel. d > 1 samples every d-th row and column and
+         * bilinearly upsamples the rest (Scene::renderCoarseLayers). Only
+         * continuous-UV patterns on raster displays qualify.
+         */
+        uint8_t renderDivisor(const RasterDisplayInfo &rasterDisplay) const;
+
+        /**
+         * @brief Frames between refreshes of each of this layer's pixels.
+         *
+         * 1 renders every pixel every frame. N > 1 renders an interleaved
+         * 1/N of the pixels each frame and reuses the others' last output;
+         * 0 lets the scene pick 1..POLAR_SHADER_FRAME_SKIP_MAX from how fast
+         * the output changes. Layers on a coarse grid (renderDivisor() > 1)
+         * always refresh every frame.
+         */
+        uint8_t getFrameDivisor() const { return frameDivisor; }
+
         u0x16 getAlpha() const { return alpha; }
         BlendMode getBlendMode() const { return blendMode; }
     };
@@ -46,6 +46,8 @@ namespace PolarShader {
         std::shared_ptr<PipelineContext> context = std::make_shared<PipelineContext>();
         u0x16 alpha{0xFFFFu};
         BlendMode blendMode{BlendMode::Normal};
+        uint8_t renderDivisor{0};
+        uint8_t frameDivisor{1};
 
     public:
         LayerBuilder(
@@ -88,6 +90,32 @@ namespace PolarShader {
             return std::move(*this);
         }
 
+        // Samples the layer every `divisor` raster rows and columns and
+        // upsamples the rest; 1 keeps full resolution, 0 (the default) uses
+        // the pattern's declared bandwidth. See Layer::renderDivisor().
+        LayerBuilder &setRenderDivisor(uint8_t divisor) & {
+            renderDivisor = divisor;
+            return *this;
+        }
+
+        LayerBuilder &&setRenderDivisor(uint8_t divisor) && {
+            renderDivisor = divisor;
+            return std::move(*this);
+        }
+
+        // Refreshes each pixel every `divisor` frames, reusing its last output
+        // in between; 0 adapts to how fast the layer changes. See
+        // Layer::getFrameDivisor().
+        LayerBuilder &setFrameDivisor(uint8_t divisor) & {
+            frameDivisor = divisor;
+            return *this;
+        }
+
+        LayerBuilder &&setFrameDivisor(uint8_t divisor) && {
+            frameDivisor = divisor;
+            return std::move(*this);
+        }
+
         LayerBuilder &setPaletteIsRainbow(bool isRainbow) & {
             context->paletteIsRainbow = isRainbow;
             return *this;
@@ -22,6 +22,9 @@
 #include "renderer/pipeline/maths/PatternMaths.h"
 #include "renderer/pipeline/maths/PolarMaths.h"
 #include "renderer/pipeline/maths/units/Units.h"
+#include "renderer/pipeline/transforms/src/MirrorUv.h"
+#include "renderer/profiling/FrameProfiler.h"
+#include "renderer/profiling/OpCounter.h"
 #if defined(ARDUINO) || defined(__EMSCRIPTEN__)
 #include <Arduino.h>
 #include "FastLED.h"
@@ -32,24 +35,124 @@
 
 namespace PolarShader {
     namespace {
+        CRGB paletteLookup(const CRGBPalette16 &palette, uint8_t index, uint8_t brightness) {
+            POLAR_SHADER_COUNT_OP(PaletteLookup);
+            return ColorFromPalette(palette, index, brightness, LINEARBLEND);
+        }
+
         uint16_t scaleRgbChannel(uint16_t channel, uint16_t value, uint16_t mask) {
             uint16_t scaled = scale16(channel, value);
             if (mask != U0X16_MAX) scaled = scale16(scaled, mask);
             return scaled;
         }
 
+        // Leaves built without a span form (e.g. a hand-assembled UVLayer) get
+        // a per-pixel fallback so the span chain is always complete.
+        void ensureUvLayerSpan(UVLayer &layer) {
+            if (layer.scalar && !layer.scalarSpan) {
+                layer.scalarSpan = makeUvSpan<PatternNormU0x16>(layer.scalar);
+            }
+            if (layer.palette && !layer.paletteSpan) {
+                layer.paletteSpan = makeUvSpan<PaletteSample>(layer.palette);
+            }
+            if (layer.rgb && !layer.rgbSpan) {
+                layer.rgbSpan = makeUvSpan<RgbSample>(layer.rgb);
+            }
+        }
+
         bool hasUvLayerMap(const UVLayer &layer) {
             switch (layer.kind) {
                 case UVLayerKind::Palette:
-                    return static_cast<bool>(layer.palette);
+                    return static_cast<bool>(layer.paletteSpan);
                 case UVLayerKind::Rgb:
-                    return static_cast<bool>(layer.rgb);
+                    return static_cast<bool>(layer.rgbSpan);
                 case UVLayerKind::Scalar:
                 default:
-                    return static_cast<bool>(layer.scalar);
+                    return static_cast<bool>(layer.scalarSpan);
             }
         }
 
+        // Polar-native steps in the order a pixel meets them (outermost first).
+        using PolarRun = fl::vector<PolarWarp>;
+
+        // Span form of a fused run: one conversion to polar (skipped when the
+        // batch arrives in polar form), every edit in turn, one conversion back.
+        template<typename Sample>
+        fl::function<void(UV *, Sample *, uint16_t)> fusePolarSpan(
+            fl::function<void(UV *, Sample *, uint16_t)> source,
+            const PolarRun &run,
+            bool polarInput
+        ) {
+            if (!source) return {};
+            return [source = std::move(source), run, polarInput](UV *uvs, Sample *out, uint16_t count) {
+                if (!polarInput) {
+                    const bool mirror = run[0].mirrorsInput;
+                    for (uint16_t i = 0; i < count; ++i) {
+                        uvs[i] = cartesianToPolarUV(mirror ? mirrorUv(uvs[i]) : uvs[i]);
+                    }
+                }
+                for (size_t w = 0; w < run.size(); ++w) {
+                    run[w].span(uvs, count);
+                }
+                for (uint16_t i = 0; i < count; ++i) {
+                    uvs[i] = polarToCartesianUV(uvs[i]);
+                }
+                source(uvs, out, count);
+            };
+        }
+
+        // Swaps `fused`'s span chain (built step by step) for a single fused
+        // stage over `inner`, the layer the run was applied to. The per-pixel
+        // forms keep their step-by-step chain.
+        void fusePolarRun(UVLayer &fused, const UVLayer &inner, const PolarRun &run, bool polarInput) {
+            fused.scalarSpan = fusePolarSpan<PatternNormU0x16>(inner.scalarSpan, run, polarInput);
+            fused.paletteSpan = fusePolarSpan<PaletteSample>(inner.paletteSpan, run, polarInput);
+            fused.rgbSpan = fusePolarSpan<RgbSample>(inner.rgbSpan, run, polarInput);
+        }
+
+        // Final UV stage: takes each display point's Cartesian UV (precomputed
+        // by the renderer when available, converted from (angle, radius)
+        // otherwise), samples the whole batch through the leaf span, then maps
+        // each sample to a colour. With `polarInput` the chain starts with a
+        // fused polar run, so it is handed the points' (angle, radius) instead.
+        template<typename Sample, typename ColourFn>
+        std::unique_ptr<ColourSpanMap> makeUvColourSpan(
+            fl::function<void(UV *, Sample *, uint16_t)> source,
+            ColourFn toColour,
+            bool polarInput
+        ) {
+            return std::make_unique<ColourSpanMap>([source = std::move(source), toColour, polarInput](
+                const RenderPoint *points,
+                const UV *cartesian,
+                CRGB *out,
+                uint16_t count
+            ) {
+                UV uvs[SPAN_CHUNK_SIZE];
+                Sample samples[SPAN_CHUNK_SIZE];
+                for (uint16_t start = 0; start < count; start += SPAN_CHUNK_SIZE) {
+                    const uint16_t remaining = static_cast<uint16_t>(count - start);
+                    const uint16_t n = remaining < SPAN_CHUNK_SIZE ? remaining : SPAN_CHUNK_SIZE;
+                    // Copied even when precomputed: stages warp `uvs` in place.
+                    if (polarInput) {
+                        for (uint16_t i = 0; i < n; ++i) {
+                            uvs[i] = UV(
+                                fl::s16x16::from_raw(raw(points[start + i].angle)),
+                                fl::s16x16::from_raw(raw(points[start + i].radius))
+                            );
+                        }
+                    } else if (cartesian) {
+                        for (uint16_t i = 0; i < n; ++i) uvs[i] = cartesian[start + i];
+                    } else {
+                        for (uint16_t i = 0; i < n; ++i) uvs[i] = polarToCartesianUV(points[start + i]);
+                    }
+                    source(uvs, samples, n);
+                    for (uint16_t i = 0; i < n; ++i) {
+                        out[start + i] = toColour(samples[i]);
+                    }
+                }
+            });
+        }
+
         PaletteSample rgbToPaletteSample(RgbSample sample) {
             const uint16_t r = raw(sample.red());
             const uint16_t g = raw(sample.green());
@@ -96,6 +199,133 @@ namespace PolarShader {
             if (hue < 0) hue += static_cast<int32_t>(ANGLE_FULL_TURN_U32);
             return PaletteSample(PatternNormU0x16(static_cast<uint16_t>(hue)), PatternNormU0x16(effectiveValue));
         }
+
+        // Context fields the palette mapping reads besides the sample itself.
+        struct PaletteInputs {
+            uint16_t clip{0};
+            uint16_t feather{0};
+            uint8_t offset{0};
+            PipelineContext::PaletteTintMode mode{PipelineContext::PaletteTintMode::HueRemap};
+            bool clipEnabled{false};
+            bool clipInvert{false};
+            bool rainbow{false};
+
+            bool operator==(const PaletteInputs &other) const {
+                return clip == other.clip && feather == other.feather && offset == other.offset &&
+                       mode == other.mode && clipEnabled == other.clipEnabled &&
+                       clipInvert == other.clipInvert && rainbow == other.rainbow;
+            }
+        };
+
+        PaletteInputs paletteInputs(const std::shared_ptr<PipelineContext> &context) {
+            PaletteInputs inputs;
+            if (!context) return inputs;
+            inputs.clip = raw(context->paletteClip);
+            inputs.feather = raw(context->paletteClipFeather);
+            inputs.offset = context->paletteOffset;
+            inputs.mode = context->paletteTintMode;
+            inputs.clipEnabled = context->paletteClipEnabled;
+            inputs.clipInvert = context->paletteClipInvert;
+            inputs.rainbow = context->paletteIsRainbow;
+            return inputs;
+        }
+
+        // Colours a raster layer produced per cell, each stamped with its
+        // row's change generation when sampled. A cell is reused while that
+        // stamp still matches and the palette inputs are unchanged. Row
+        // generations only grow, so a stamp below the row's generation can
+        // never match again.
+        class RasterCellCache {
+        public:
+            void sync(const RasterChangeLog &changes, const PaletteInputs &inputs) {
+                const uint32_t cells = static_cast<uint32_t>(changes.width) * changes.height;
+                const bool resized = colours.size() != cells || width != changes.width;
+                if (resized) {
+                    colours.resize(cells);
+                    stamps.resize(cells);
+                    width = changes.width;
+                }
+                if (resized || !(inputs == lastInputs)) {
+                    invalidate(changes);
+                }
+                lastInputs = inputs;
+            }
+
+            // Cache slot of `point`, or -1 when it is not a cell of the board.
+            int32_t index(const RasterPoint &point, const RasterChangeLog &changes) const {
+                if (!point.valid || point.width != changes.width || point.height != changes.height ||
+                    point.x >= changes.width || point.y >= changes.height) {
+                    return -1;
+                }
+                return static_cast<int32_t>(static_cast<uint32_t>(point.y) * changes.width + point.x);
+            }
+
+            bool fresh(int32_t idx, uint16_t y, const RasterChangeLog &changes) const {
+                return stamps[idx] == changes.rows[y];
+            }
+
+            void store(int32_t idx, uint16_t y, const RasterChangeLog &changes, CRGB colour) {
+                colours[idx] = colour;
+                stamps[idx] = changes.rows[y];
+            }
+
+            CRGB colour(int32_t idx) const { return colours[idx]; }
+
+        private:
+            fl::vector<CRGB> colours;
+            fl::vector<uint32_t> stamps;
+            uint16_t width{0};
+            PaletteInputs lastInputs{};
+
+            void invalidate(const RasterChangeLog &changes) {
+                for (uint16_t y = 0; y < changes.height; ++y) {
+                    const uint32_t stale = changes.rows[y] - 1u;
+                    const uint32_t row = static_cast<uint32_t>(y) * changes.width;
+                    for (uint16_t x = 0; x < changes.width; ++x) stamps[row + x] = stale;
+                }
+            }
+        };
+
+        // Raster leaf: maps each point's cell sample to a colour. When the
+        // pattern keeps a change log, cells of unchanged rows reuse the
+        // colour they were last given instead of being sampled again.
+        template<typename Sample, typename ColourFn>
+        std::unique_ptr<ColourSpanMap> makeRasterColourSpan(
+            const UVPattern *pattern,
+            fl::function<Sample(const RasterPoint &)> layer,
+            ColourFn toColour,
+            std::shared_ptr<PipelineContext> context
+        ) {
+            return std::make_unique<ColourSpanMap>([
+                pattern,
+                layer = std::move(layer),
+                toColour,
+                context = std::move(context),
+                cache = std::make_shared<RasterCellCache>()
+            ](const RenderPoint *points, const UV *, CRGB *out, uint16_t count) {
+                const RasterChangeLog *changes = pattern->rasterChanges();
+                if (!changes || !changes->rows) {
+                    for (uint16_t i = 0; i < count; ++i) {
+                        out[i] = toColour(layer(points[i].raster));
+                    }
+                    return;
+                }
+
+                cache->sync(*changes, paletteInputs(context));
+                for (uint16_t i = 0; i < count; ++i) {
+                    const RasterPoint &point = points[i].raster;
+                    const int32_t idx = cache->index(point, *changes);
+                    if (idx < 0) {
+                        out[i] = toColour(layer(point));
+                        continue;
+                    }
+                    if (!cache->fresh(idx, point.y, *changes)) {
+                        cache->store(idx, point.y, *changes, toColour(layer(point)));
+                    }
+                    out[i] = cache->colour(idx);
+                }
+            });
+        }
     }
 
     Layer::Layer(
@@ -105,30 +335,41 @@ namespace PolarShader {
         const char *name,
         std::shared_ptr<PipelineContext> context,
         u0x16 alpha,
-        BlendMode blendMode
+        BlendMode blendMode,
+        uint8_t renderDivisor,
+        uint8_t frameDivisor
     ) : pattern(std::move(pattern)),
         palette(palette),
         steps(std::move(steps)),
         name(name ? name : "unnamed"),
         context(std::move(context)),
         alpha(alpha),
-        blendMode(blendMode) {
+        blendMode(blendMode),
+        renderDivisorSetting(renderDivisor),
+        frameDivisor(frameDivisor) {
         Serial.print("Building layer: ");
         Serial.println(this->name);
 
         if (!this->context) this->context = std::make_shared<PipelineContext>();
         if (this->pattern) this->pattern->setContext(this->context);
 
+        bool sampleReuse = false;
         for (auto &step: this->steps) {
-            if (step.uvTransform) step.uvTransform->setContext(this->context);
+            if (step.uvTransform) {
+                step.uvTransform->setContext(this->context);
+                sampleReuse = sampleReuse || step.uvTransform->repeatsSamples();
+            }
             if (step.paletteTransform) step.paletteTransform->setContext(this->context);
         }
+        if (this->pattern) this->pattern->setSampleReuse(sampleReuse);
     }
 
-    std::unique_ptr<ColourMap> Layer::blackLayer(const char *reason) {
+    std::unique_ptr<ColourSpanMap> Layer::blackLayer(const char *reason) {
         if (reason) Serial.println(reason);
-        return std::make_unique<ColourMap>([](const RenderPoint&) {
-            return CRGB::Black;
+        return std::make_unique<ColourSpanMap>([](const RenderPoint *, const UV *, CRGB *out, uint16_t count) {
+            for (uint16_t i = 0; i < count; ++i) {
+                out[i] = CRGB::Black;
+            }
         });
     }
 
@@ -173,7 +414,7 @@ namespace PolarShader {
             // the whole scene; the pattern value drives alpha (brightness),
             // further shaped by the clip mask. When the clip signal is 0 the
             // mask is fully open (U0X16_MAX), so alpha reduces to the raw value.
-            CRGB color = ColorFromPalette(palette, offset, 255, LINEARBLEND);
+            CRGB color = paletteLookup(palette, offset, 255);
             uint16_t alpha = scale16(hue_value, mask_value);
             color.nscale8_video(static_cast<uint8_t>(alpha >> 8));
             return color;
@@ -198,7 +439,7 @@ namespace PolarShader {
         uint8_t bright = fl::map16_to_8(hue_value);
         uint8_t index = static_cast<uint8_t>(bright + offset);
 
-        CRGB color = ColorFromPalette(palette, index, bright, LINEARBLEND);
+        CRGB color = paletteLookup(palette, index, bright);
         if (context && context->paletteClipEnabled && mask_value != U0X16_MAX) {
             color.nscale8_video(static_cast<uint8_t>(mask_value >> 8));
         }
@@ -223,7 +464,7 @@ namespace PolarShader {
             // Colour-mask mode deliberately overrides the emitted hue: a single
             // paletteOffset tint for the whole scene, with the value channel
             // (shaped by the clip mask) driving alpha. Matches mapPalette.
-            CRGB color = ColorFromPalette(palette, offset, 255, LINEARBLEND);
+            CRGB color = paletteLookup(palette, offset, 255);
             uint16_t alpha = scale16(value_raw, mask_value);
             color.nscale8_video(static_cast<uint8_t>(alpha >> 8));
             return color;
@@ -245,7 +486,7 @@ namespace PolarShader {
 
         // HueRemap: the emitted hue selects the palette entry (offset = phase)
         // and the emitted value drives brightness.
-        CRGB color = ColorFromPalette(palette, hue8, bright, LINEARBLEND);
+        CRGB color = paletteLookup(palette, hue8, bright);
         if (context && context->paletteClipEnabled && mask_value != U0X16_MAX) {
             color.nscale8_video(static_cast<uint8_t>(mask_value >> 8));
         }
@@ -264,7 +505,7 @@ namespace PolarShader {
         const uint8_t offset = context ? context->paletteOffset : 0;
 
         if (mode == PipelineContext::PaletteTintMode::ColourMask) {
-            CRGB color = ColorFromPalette(palette, offset, 255, LINEARBLEND);
+            CRGB color = paletteLookup(palette, offset, 255);
             uint16_t alpha = scale16(value_raw, mask_value);
             color.nscale8_video(static_cast<uint8_t>(alpha >> 8));
             return color;
@@ -291,7 +532,31 @@ namespace PolarShader {
         context->rasterDisplay = rasterDisplay;
     }
 
+    uint8_t Layer::renderDivisor(const RasterDisplayInfo &rasterDisplay) const {
+        if (!POLAR_SHADER_COARSE_RENDER || !rasterDisplay.valid || !pattern) return 1;
+        if (pattern->domain() != PatternDomain::ContinuousUV) return 1;
+
+        uint8_t divisor = renderDivisorSetting;
+        if (divisor == 0) {
+            if (rasterDisplay.cellCount < POLAR_SHADER_COARSE_RENDER_AUTO_MIN_CELLS) return 1;
+            for (const auto &step: steps) {
+                if (step.uvTransform) return 1;
+            }
+            divisor = pattern->bandwidthDivisor();
+        }
+        if (divisor > POLAR_SHADER_COARSE_RENDER_MAX_DIVISOR) divisor = POLAR_SHADER_COARSE_RENDER_MAX_DIVISOR;
+        return divisor == 0 ? 1 : divisor;
+    }
+
+    void Layer::setQuality(u0x16 quality) {
+        if (!context) {
+            context = std::make_shared<PipelineContext>();
+        }
+        context->quality = quality;
+    }
+
     void Layer::advanceFrame(u0x16 progress, TimeMillis elapsedMs) {
+        POLAR_SHADER_PROFILE_SCOPE(ProfileStage::LayerAdvance, name);
         if (!context) {
             Serial.println("Layer::advanceFrame context is null.");
         } else {
@@ -299,10 +564,14 @@ namespace PolarShader {
         }
 
         if (pattern) {
+            POLAR_SHADER_PROFILE_SCOPE(ProfileStage::LayerAdvance, name, 0);
             pattern->advanceFrame(progress, elapsedMs);
         }
 
-        for (const auto &step: steps) {
+        for (size_t i = 0; i < steps.size(); ++i) {
+            const auto &step = steps[i];
+            // Steps are numbered from 1 in pipeline order; 0 is the pattern.
+            POLAR_SHADER_PROFILE_SCOPE(ProfileStage::LayerAdvance, name, static_cast<uint8_t>(i + 1));
             if (step.uvTransform) {
                 step.uvTransform->advanceFrame(progress, elapsedMs);
             }
@@ -313,6 +582,15 @@ namespace PolarShader {
     }
 
     std::unique_ptr<ColourMap> Layer::compile() const {
+        std::unique_ptr<ColourSpanMap> compiled = compileSpan();
+        return std::make_unique<ColourMap>([span = std::move(*compiled)](const RenderPoint &point) {
+            CRGB colour;
+            span(&point, nullptr, &colour, 1);
+            return colour;
+        });
+    }
+
+    std::unique_ptr<ColourSpanMap> Layer::compileSpan() const {
         if (!pattern) return blackLayer("Layer::compile has no base pattern.");
 
         if (pattern->domain() == PatternDomain::RasterGrid) {
@@ -325,61 +603,111 @@ namespace PolarShader {
             if (pattern->emitsColour()) {
                 RasterColourMap currentRasterColour = pattern->rasterColourLayer(context);
                 if (currentRasterColour) {
-                    return std::make_unique<ColourMap>([
-                        palette = palette,
-                        layer = std::move(currentRasterColour),
-                        context = context
-                    ](const RenderPoint &point) {
-                        PaletteSample sample = layer(point.raster);
-                        return tintPalette(palette, sample, context);
-                    });
+                    return makeRasterColourSpan<PaletteSample>(
+                        pattern.get(),
+                        std::move(currentRasterColour),
+                        [palette = palette, context = context](PaletteSample sample) {
+                            return tintPalette(palette, sample, context);
+                        },
+                        context
+                    );
                 }
             }
 
             RasterMap currentRaster = pattern->rasterLayer(context);
             if (!currentRaster) return blackLayer("Raster pattern returned no raster layer.");
 
-            return std::make_unique<ColourMap>([palette = palette, layer = std::move(currentRaster), context = context](
-                const RenderPoint &point
-            ) {
-                PatternNormU0x16 value = layer(point.raster);
-                return mapPalette(palette, value, context);
-            });
+            return makeRasterColourSpan<PatternNormU0x16>(
+                pattern.get(),
+                std::move(currentRaster),
+                [palette = palette, context = context](PatternNormU0x16 value) {
+                    return mapPalette(palette, value, context);
+                },
+                context
+            );
         }
 
         UVLayer currentUV = pattern->uvLayer(context);
+        ensureUvLayerSpan(currentUV);
         if (!hasUvLayerMap(currentUV)) return blackLayer("Continuous pattern returned no UV layer.");
 
-        // Apply transforms in order
-        for (const auto &step: steps) {
-            if (step.kind == PipelineStepKind::UV) {
-                if (!step.uvTransform) return blackLayer("UV step missing transform.");
-                currentUV = step.uvTransform->apply(currentUV);
+        size_t uvStepEnd = 0;
+        for (size_t i = 0; i < steps.size(); ++i) {
+            if (steps[i].kind == PipelineStepKind::UV) uvStepEnd = i + 1;
+        }
+
+        // Apply transforms in order. Adjacent polar-native steps (see
+        // UVTransform::polarWarp) are fused in the span chain so the batch is
+        // converted to polar once per run; a run that is the outermost stage
+        // starts from the display's own (angle, radius) and skips it entirely.
+        bool polarInput = false;
+        for (size_t i = 0; i < steps.size();) {
+            const auto &step = steps[i];
+            if (step.kind != PipelineStepKind::UV) {
+                ++i;
+                continue;
+            }
+            if (!step.uvTransform) return blackLayer("UV step missing transform.");
+
+            const UVLayer inner = currentUV;
+            fl::vector<PolarWarp> warps;
+            size_t end = i;
+            for (; end < steps.size(); ++end) {
+                if (steps[end].kind != PipelineStepKind::UV) continue;
+                if (!steps[end].uvTransform) break;
+                PolarWarp warp = steps[end].uvTransform->polarWarp();
+                if (!warp.span) break;
+                warps.push_back(std::move(warp));
+                currentUV = steps[end].uvTransform->apply(currentUV);
                 if (!hasUvLayerMap(currentUV)) return blackLayer("UV transform returned no UV layer.");
             }
-        }
 
-        // Final stage: map UV back to Polar domain for the display,
-        // then map pattern value to a color from the palette.
-        return std::make_unique<ColourMap>([palette = palette, layer = std::move(currentUV), context = context](
-            const RenderPoint &point
-        ) {
-            // Display provides (Angle, Radius) in legacy u0x16/s0x16.
-            // Convert to UV (fl::u16x16/fl::s16x16 (Q16.16)).
-            UV input = polarToCartesianUV(UV(
-                fl::s16x16::from_raw(raw(point.angle)),
-                fl::s16x16::from_raw(raw(point.radius))
-            ));
+            if (warps.empty()) {
+                currentUV = step.uvTransform->apply(currentUV);
+                if (!hasUvLayerMap(currentUV)) return blackLayer("UV transform returned no UV layer.");
+                ++i;
+                continue;
+            }
 
-            switch (layer.kind) {
-                case UVLayerKind::Palette:
-                    return tintPalette(palette, layer.palette(input), context);
-                case UVLayerKind::Rgb:
-                    return mapRgb(palette, layer.rgb(input), context);
-                case UVLayerKind::Scalar:
-                default:
-                    return mapPalette(palette, layer.scalar(input), context);
+            const bool outermost = end >= uvStepEnd;
+            if (warps.size() > 1 || outermost) {
+                PolarRun run;
+                for (size_t w = warps.size(); w > 0; --w) run.push_back(warps[w - 1]);
+                fusePolarRun(currentUV, inner, run, outermost);
+                polarInput = outermost;
             }
-        });
+            i = end;
+        }
+
+        // Final stage: map UV back to Polar domain for the display, then map
+        // pattern value to a color from the palette. Only the span chain is
+        // kept; the per-pixel chain is released with currentUV.
+        switch (currentUV.kind) {
+            case UVLayerKind::Palette:
+                return makeUvColourSpan<PaletteSample>(
+                    std::move(currentUV.paletteSpan),
+                    [palette = palette, context = context](PaletteSample sample) {
+                        return tintPalette(palette, sample, context);
+                    },
+                    polarInput
+                );
+            case UVLayerKind::Rgb:
+                return makeUvColourSpan<RgbSample>(
+                    std::move(currentUV.rgbSpan),
+                    [palette = palette, context = context](RgbSample sample) {
+                        return mapRgb(palette, sample, context);
+                    },
+                    polarInput
+                );
+            case UVLayerKind::Scalar:
+            default:
+                return makeUvColourSpan<PatternNormU0x16>(
+                    std::move(currentUV.scalarSpan),
+                    [palette = palette, context = context](PatternNormU0x16 value) {
+                        return mapPalette(palette, value, context);
+                    },
+                    polarInput
+                );
+        }
     }
 }
@@ -12,9 +12,9 @@ namespace PolarShader {
     Layer LayerBuilder::build() {
         if (built) {
             Serial.println("LayerBuilder::build called more than once; returning black layer.");
-            return Layer(std::move(pattern), palette, {}, name, context, alpha, blendMode);
+            return Layer(std::move(pattern), palette, {}, name, context, alpha, blendMode, renderDivisor, frameDivisor);
         }
         built = true;
-        return Layer(std::move(pattern), palette, std::move(steps), name, context, alpha, blendMode);
+        return Layer(std::move(pattern), palette, std::move(steps), name, context, alpha, blendMode, renderDivisor, frameDivisor);
     }
 }
@@ -71,6 +71,10 @@ namespace PolarShader {
         // Logical raster geometry for display-native pixel-grid patterns.
         RasterDisplayInfo rasterDisplay{};
 
+        // Share of their full iteration budget that iteration-heavy patterns
+        // may spend this frame; set by the display's QualityGovernor.
+        u0x16 quality = u0x16(U0X16_MAX);
+
         // Palette brightness is always full when mapping colors.
     };
 }
@@ -27,6 +27,7 @@
 #include "native/FastLED.h"
 #endif
 #include "renderer/pipeline/maths/units/Units.h"
+#include "renderer/profiling/OpCounter.h"
 
 namespace PolarShader {
     constexpr u0x16 angleFrac(uint32_t denominator) {
@@ -54,11 +55,13 @@ namespace PolarShader {
     }
 
     inline s0x16 angleSinU0x16(u0x16 a) {
+        POLAR_SHADER_COUNT_OP(Trig);
         int16_t raw_q1_15 = sin16(angleToFastLedPhase(a));
         return s0x16(static_cast<int32_t>(raw_q1_15) << 1);
     }
 
     inline s0x16 angleCosU0x16(u0x16 a) {
+        POLAR_SHADER_COUNT_OP(Trig);
         int16_t raw_q1_15 = cos16(angleToFastLedPhase(a));
         return s0x16(static_cast<int32_t>(raw_q1_15) << 1);
     }
@@ -22,6 +22,7 @@
 #define POLAR_SHADER_PIPELINE_MATHS_FIXEDPOINTMATHS_H
 
 #include "renderer/pipeline/maths/units/Units.h"
+#include "renderer/profiling/OpCounter.h"
 
 namespace PolarShader {
     constexpr int32_t mulQ16Raw(int32_t aRaw, int32_t bRaw) {
@@ -56,6 +57,7 @@ namespace PolarShader {
     }
 
     inline fl::s16x16 mulS16x16(fl::s16x16 value, s0x16 scale) {
+        POLAR_SHADER_COUNT_OP(Mul64);
         return fl::s16x16::from_raw(mulQ16Raw(raw(value), raw(scale)));
     }
 
@@ -64,6 +66,7 @@ namespace PolarShader {
     }
 
     inline fl::s16x16 lerpS16x16(fl::s16x16 a, fl::s16x16 b, u0x16 t) {
+        POLAR_SHADER_COUNT_OP(Mul64);
         return fl::s16x16::from_raw(lerpQ16Raw(raw(a), raw(b), raw(t)));
     }
 
@@ -23,6 +23,19 @@
 
 #include "renderer/pipeline/maths/units/Units.h"
 #include "renderer/pipeline/maths/PatternMaths.h"
+#include <memory>
+
+// Lattice columns memoised per NoisePattern sampler (see NoiseLatticeCache).
+// Must be a power of two; 0 samples inoise16 directly.
+#ifndef POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES
+#define POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES 256
+#endif
+
+static_assert(
+    (POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES & (POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES - 1)) == 0 &&
+    POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES <= 32768,
+    "POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES must be 0 or a power of two up to 32768"
+);
 
 namespace PolarShader {
     inline constexpr uint32_t NOISE_DOMAIN_OFFSET = 0x4000;
@@ -45,6 +58,53 @@ namespace PolarShader {
 
     NoiseRawU0x16 sampleNoiseTrilinear(uint32_t x, uint32_t y, uint32_t z);
 
+    /**
+     * @brief Direct-mapped memo of inoise16 lattice columns.
+     *
+     * Each entry holds the noise at lattice point (x, y, z) and (x, y, z + 1),
+     * keyed on all three coordinates, so an entry never goes stale: depth
+     * moves slowly and most columns are reused on the following frames.
+     * Lookups write the memo, so each render core needs its own instance.
+     *
+     * Without zoom or mirroring, neighbouring pixels sit several lattice units
+     * apart and share no columns, so NoisePattern only builds a memo for
+     * layers that repeat samples. Even there, a window of probes with fewer
+     * hits than the probe cost pays for bypasses the memo for a while, then
+     * tries again.
+     */
+    class NoiseLatticeCache {
+    public:
+        explicit NoiseLatticeCache(uint16_t entryCount = POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES);
+
+        void clear();
+
+        void column(uint32_t x_int, uint32_t y_int, uint32_t z_int, uint16_t &lower, uint16_t &upper);
+
+        // False while bypassed; counts the samples of the bypass down.
+        bool engaged();
+
+    private:
+        struct Entry {
+            uint32_t x;
+            uint32_t y;
+            uint32_t z;
+            uint16_t lower;
+            uint16_t upper;
+        };
+
+        std::unique_ptr<Entry[]> entries;
+        uint16_t mask;
+        uint16_t windowProbes = 0;
+        uint16_t windowHits = 0;
+        uint16_t bypassSamples = 0;
+    };
+
+    /**
+     * @brief sampleNoiseTrilinear() reading its four lattice columns through
+     * `cache`; the result is identical.
+     */
+    NoiseRawU0x16 sampleNoiseTrilinear(uint32_t x, uint32_t y, uint32_t z, NoiseLatticeCache &cache);
+
     inline NoiseRawU0x16 sampleNoiseBilinear(fl::u24x8 x, fl::u24x8 y) {
         return sampleNoiseBilinear(x.raw(), y.raw());
     }
@@ -22,11 +22,22 @@
 #define POLAR_SHADER_PIPELINE_MATHS_POLARMATHS_H
 
 #include "renderer/pipeline/maths/units/Units.h"
+#include "renderer/RenderPoint.h"
 
 namespace PolarShader {
     /** @brief Converts normalized Polar UV (Angle=U, Radius=V) to Cartesian UV. */
     UV polarToCartesianUV(UV polar_uv);
 
+    /** @brief Converts a display point's (angle, radius) to Cartesian UV. */
+    inline UV polarToCartesianUV(const RenderPoint &point) {
+        // Display provides (Angle, Radius) in legacy u0x16/s0x16.
+        // Convert to UV (fl::u16x16/fl::s16x16 (Q16.16)).
+        return polarToCartesianUV(UV(
+            fl::s16x16::from_raw(raw(point.angle)),
+            fl::s16x16::from_raw(raw(point.radius))
+        ));
+    }
+
     /** @brief Converts Cartesian UV to normalized Polar UV (Angle=U, Radius=V). */
     UV cartesianToPolarUV(UV cart_uv);
 
@@ -27,6 +27,7 @@
 #include "native/FastLED.h"
 #endif
 #include "renderer/pipeline/maths/units/Units.h"
+#include "renderer/profiling/OpCounter.h"
 
 namespace PolarShader {
     namespace detail {
@@ -40,6 +41,7 @@ namespace PolarShader {
     inline fl::i32 mulI32U0x16Sat(fl::i32 value, u0x16 scale) {
         uint16_t scale_raw = raw(scale);
         if (scale_raw == U0X16_MAX) return value;
+        POLAR_SHADER_COUNT_OP(Mul64);
         int64_t result = static_cast<int64_t>(value) * static_cast<int64_t>(scale_raw);
         result += (result >= 0) ? U16_HALF : -U16_HALF;
         result >>= 16;
@@ -48,6 +50,7 @@ namespace PolarShader {
     }
 
     inline s0x16 mulS0x16Sat(s0x16 a, s0x16 b) {
+        POLAR_SHADER_COUNT_OP(Mul64);
         int64_t result = static_cast<int64_t>(raw(a)) * static_cast<int64_t>(raw(b));
         result += (result >= 0) ? U16_HALF : -U16_HALF;
         result >>= 16;
@@ -56,6 +59,7 @@ namespace PolarShader {
     }
 
     inline s0x16 scaleS0x16(s0x16 value, u0x16 scale) {
+        POLAR_SHADER_COUNT_OP(Mul64);
         int64_t result = static_cast<int64_t>(raw(value)) * static_cast<int64_t>(raw(scale));
         result += (result >= 0) ? U16_HALF : -U16_HALF;
         result >>= 16;
@@ -63,6 +67,18 @@ namespace PolarShader {
         return s0x16(static_cast<int32_t>(result));
     }
 
+    // 64-bit quotients. Cortex-M has no 64-bit divide, so per-pixel divides go
+    // through these for the op-count build to see them.
+    inline int64_t divI64(int64_t numerator, int64_t denominator) {
+        POLAR_SHADER_COUNT_OP(Div64);
+        return numerator / denominator;
+    }
+
+    inline uint64_t divU64(uint64_t numerator, uint64_t denominator) {
+        POLAR_SHADER_COUNT_OP(Div64);
+        return numerator / denominator;
+    }
+
     inline uint64_t sqrtU64Raw(uint64_t value) {
         uint64_t op = value;
         uint64_t res = 0;
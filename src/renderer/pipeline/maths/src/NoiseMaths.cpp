@@ -19,6 +19,7 @@
  */
 
 #include "renderer/pipeline/maths/NoiseMaths.h"
+#include "renderer/profiling/OpCounter.h"
 #if defined(ARDUINO) || defined(__EMSCRIPTEN__)
 #include <FastLED.h>
 #else
@@ -26,6 +27,44 @@
 #endif
 
 namespace PolarShader {
+    namespace {
+        // a + (b - a) * frac / 65536, rounded down. The product is split at
+        // frac's low byte so it stays within int32_t for any two u16 values.
+        inline int32_t lerpLattice(int32_t a, int32_t b, uint16_t frac) {
+            const int32_t d = b - a;
+            const int32_t high = d * static_cast<int32_t>(frac >> 8);
+            const int32_t low = d * static_cast<int32_t>(frac & 0xFFu);
+            return a + ((high + (low >> 8)) >> 8);
+        }
+
+        inline uint16_t latticeFraction(uint32_t coord) {
+            return static_cast<uint16_t>((coord & 0xFFu) << 8);
+        }
+
+        // Shared by both sampleNoiseTrilinear() overloads so they match bit for bit.
+        NoiseRawU0x16 interpolateTrilinear(
+            uint32_t x, uint32_t y, uint32_t z,
+            uint16_t n000, uint16_t n100, uint16_t n010, uint16_t n110,
+            uint16_t n001, uint16_t n101, uint16_t n011, uint16_t n111
+        ) {
+            const uint16_t x_frac = latticeFraction(x);
+            const uint16_t y_frac = latticeFraction(y);
+            const uint16_t z_frac = latticeFraction(z);
+
+            const int32_t nx00 = lerpLattice(n000, n100, x_frac);
+            const int32_t nx10 = lerpLattice(n010, n110, x_frac);
+            const int32_t nx01 = lerpLattice(n001, n101, x_frac);
+            const int32_t nx11 = lerpLattice(n011, n111, x_frac);
+
+            const int32_t nxy0 = lerpLattice(nx00, nx10, y_frac);
+            const int32_t nxy1 = lerpLattice(nx01, nx11, y_frac);
+            int32_t nxyz = lerpLattice(nxy0, nxy1, z_frac);
+            if (nxyz < 0) nxyz = 0;
+            if (nxyz > UINT16_MAX) nxyz = UINT16_MAX;
+            return NoiseRawU0x16(static_cast<uint16_t>(nxyz));
+        }
+    }
+
     uint32_t random32() {
         return (static_cast<uint32_t>(random16()) << 16) | random16();
     }
@@ -35,20 +74,18 @@ namespace PolarShader {
         // grid corners to support smooth fl::s24x8/fl::u24x8 coordinates without blocky stepping.
         uint32_t x_int = x >> 8;
         uint32_t y_int = y >> 8;
-        uint32_t frac_mask = (1u << 8) - 1u;
-        uint16_t x_frac = static_cast<uint16_t>((x & frac_mask) << (16 - 8));
-        uint16_t y_frac = static_cast<uint16_t>((y & frac_mask) << (16 - 8));
+        uint16_t x_frac = latticeFraction(x);
+        uint16_t y_frac = latticeFraction(y);
 
+        POLAR_SHADER_COUNT_OPS_N(Noise, 4);
         uint16_t n00 = inoise16(x_int << 8, y_int << 8);
         uint16_t n10 = inoise16((x_int + 1u) << 8, y_int << 8);
         uint16_t n01 = inoise16(x_int << 8, (y_int + 1u) << 8);
         uint16_t n11 = inoise16((x_int + 1u) << 8, (y_int + 1u) << 8);
 
-        int32_t nx0 = static_cast<int32_t>(n00) +
-                      ((static_cast<int32_t>(n10) - static_cast<int32_t>(n00)) * x_frac >> 16);
-        int32_t nx1 = static_cast<int32_t>(n01) +
-                      ((static_cast<int32_t>(n11) - static_cast<int32_t>(n01)) * x_frac >> 16);
-        int32_t nxy = nx0 + ((nx1 - nx0) * y_frac >> 16);
+        int32_t nx0 = lerpLattice(n00, n10, x_frac);
+        int32_t nx1 = lerpLattice(n01, n11, x_frac);
+        int32_t nxy = lerpLattice(nx0, nx1, y_frac);
         if (nxy < 0) nxy = 0;
         if (nxy > UINT16_MAX) nxy = UINT16_MAX;
         return NoiseRawU0x16(static_cast<uint16_t>(nxy));
@@ -60,11 +97,8 @@ namespace PolarShader {
         uint32_t x_int = x >> 8;
         uint32_t y_int = y >> 8;
         uint32_t z_int = z >> 8;
-        uint32_t frac_mask = (1u << 8) - 1u;
-        uint16_t x_frac = static_cast<uint16_t>((x & frac_mask) << (16 - 8));
-        uint16_t y_frac = static_cast<uint16_t>((y & frac_mask) << (16 - 8));
-        uint16_t z_frac = static_cast<uint16_t>((z & frac_mask) << (16 - 8));
 
+        POLAR_SHADER_COUNT_OPS_N(Noise, 8);
         uint16_t n000 = inoise16(x_int << 8, y_int << 8, z_int << 8);
         uint16_t n100 = inoise16((x_int + 1u) << 8, y_int << 8, z_int << 8);
         uint16_t n010 = inoise16(x_int << 8, (y_int + 1u) << 8, z_int << 8);
@@ -74,20 +108,79 @@ namespace PolarShader {
         uint16_t n011 = inoise16(x_int << 8, (y_int + 1u) << 8, (z_int + 1u) << 8);
         uint16_t n111 = inoise16((x_int + 1u) << 8, (y_int + 1u) << 8, (z_int + 1u) << 8);
 
-        int32_t nx00 = static_cast<int32_t>(n000) +
-                       ((static_cast<int32_t>(n100) - static_cast<int32_t>(n000)) * x_frac >> 16);
-        int32_t nx10 = static_cast<int32_t>(n010) +
-                       ((static_cast<int32_t>(n110) - static_cast<int32_t>(n010)) * x_frac >> 16);
-        int32_t nx01 = static_cast<int32_t>(n001) +
-                       ((static_cast<int32_t>(n101) - static_cast<int32_t>(n001)) * x_frac >> 16);
-        int32_t nx11 = static_cast<int32_t>(n011) +
-                       ((static_cast<int32_t>(n111) - static_cast<int32_t>(n011)) * x_frac >> 16);
-
-        int32_t nxy0 = nx00 + ((nx10 - nx00) * y_frac >> 16);
-        int32_t nxy1 = nx01 + ((nx11 - nx01) * y_frac >> 16);
-        int32_t nxyz = nxy0 + ((nxy1 - nxy0) * z_frac >> 16);
-        if (nxyz < 0) nxyz = 0;
-        if (nxyz > UINT16_MAX) nxyz = UINT16_MAX;
-        return NoiseRawU0x16(static_cast<uint16_t>(nxyz));
+        return interpolateTrilinear(x, y, z, n000, n100, n010, n110, n001, n101, n011, n111);
+    }
+
+    namespace {
+        // Lattice coordinates are 24-bit, so this key never matches a real column.
+        constexpr uint32_t EMPTY_LATTICE_KEY = UINT32_MAX;
+
+        // A hit saves two inoise16 calls, roughly 16 probes' worth of work, so
+        // a window under 1/16 hits costs more than it saves.
+        constexpr uint16_t LATTICE_WINDOW_PROBES = 1024;
+        constexpr uint16_t LATTICE_WINDOW_MIN_HITS = LATTICE_WINDOW_PROBES / 16;
+        constexpr uint16_t LATTICE_BYPASS_SAMPLES = 4096;
+    }
+
+    NoiseLatticeCache::NoiseLatticeCache(uint16_t entryCount)
+        : entries(std::make_unique<Entry[]>(entryCount ? entryCount : 1u)),
+          mask(static_cast<uint16_t>(entryCount ? entryCount - 1u : 0u)) {
+        clear();
+    }
+
+    void NoiseLatticeCache::clear() {
+        for (uint32_t i = 0; i <= mask; ++i) {
+            entries[i].x = EMPTY_LATTICE_KEY;
+        }
+        windowProbes = 0;
+        windowHits = 0;
+        bypassSamples = 0;
+    }
+
+    bool NoiseLatticeCache::engaged() {
+        if (bypassSamples == 0) return true;
+        --bypassSamples;
+        return false;
+    }
+
+    void NoiseLatticeCache::column(uint32_t x_int, uint32_t y_int, uint32_t z_int, uint16_t &lower, uint16_t &upper) {
+        POLAR_SHADER_COUNT_OP(NoiseProbe);
+        uint32_t hash = x_int * 0x9E3779B1u ^ y_int * 0x85EBCA77u ^ z_int * 0xC2B2AE3Du;
+        Entry &entry = entries[(hash ^ (hash >> 16)) & mask];
+        if (entry.x != x_int || entry.y != y_int || entry.z != z_int) {
+            POLAR_SHADER_COUNT_OPS_N(Noise, 2);
+            entry.x = x_int;
+            entry.y = y_int;
+            entry.z = z_int;
+            entry.lower = inoise16(x_int << 8, y_int << 8, z_int << 8);
+            entry.upper = inoise16(x_int << 8, y_int << 8, (z_int + 1u) << 8);
+        } else {
+            POLAR_SHADER_COUNT_OP(NoiseHit);
+            ++windowHits;
+        }
+        lower = entry.lower;
+        upper = entry.upper;
+
+        if (++windowProbes == LATTICE_WINDOW_PROBES) {
+            if (windowHits < LATTICE_WINDOW_MIN_HITS) bypassSamples = LATTICE_BYPASS_SAMPLES;
+            windowProbes = 0;
+            windowHits = 0;
+        }
+    }
+
+    NoiseRawU0x16 sampleNoiseTrilinear(uint32_t x, uint32_t y, uint32_t z, NoiseLatticeCache &cache) {
+        if (!cache.engaged()) return sampleNoiseTrilinear(x, y, z);
+
+        uint32_t x_int = x >> 8;
+        uint32_t y_int = y >> 8;
+        uint32_t z_int = z >> 8;
+
+        uint16_t n000, n001, n100, n101, n010, n011, n110, n111;
+        cache.column(x_int, y_int, z_int, n000, n001);
+        cache.column(x_int + 1u, y_int, z_int, n100, n101);
+        cache.column(x_int, y_int + 1u, z_int, n010, n011);
+        cache.column(x_int + 1u, y_int + 1u, z_int, n110, n111);
+
+        return interpolateTrilinear(x, y, z, n000, n100, n010, n110, n001, n101, n011, n111);
     }
 }
@@ -30,7 +30,8 @@ namespace PolarShader {
         explicit ConwayPattern(
             uint16_t stepIntervalMs = 250,
             uint16_t seed = 0,
-            uint16_t densityPermille = 350
+            uint16_t densityPermille = 350,
+            bool timeSliced = false
         );
 
         bool emitsColour() const override { return true; }
@@ -49,14 +50,17 @@ namespace PolarShader {
         void release() const override;
         void seed(uint32_t generationSeed) const override;
         bool step() const override;
+        void stepRows(uint16_t stage, uint16_t firstRow, uint16_t endRow) const override;
+        bool finishStage(uint16_t stage) const override;
 
     private:
         uint16_t densityPermille;
 
-        mutable std::unique_ptr<uint8_t[]> cells;
-        mutable std::unique_ptr<uint8_t[]> next;
+        // Bit-packed boards (raster::packedWordsPerRow) and one hue per cell,
+        // updated in place for the cells a step changes.
+        mutable std::unique_ptr<uint32_t[]> cells;
+        mutable std::unique_ptr<uint32_t[]> next;
         mutable std::unique_ptr<uint8_t[]> hues;
-        mutable std::unique_ptr<uint8_t[]> nextHues;
     };
 }
 
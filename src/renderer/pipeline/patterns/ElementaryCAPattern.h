@@ -48,8 +48,9 @@ namespace PolarShader {
     private:
         uint8_t rule;
 
-        mutable std::unique_ptr<uint8_t[]> cells;
-        mutable std::unique_ptr<uint8_t[]> rowBuf;
+        // Bit-packed grid and next bottom row (raster::packedWordsPerRow).
+        mutable std::unique_ptr<uint32_t[]> cells;
+        mutable std::unique_ptr<uint32_t[]> rowBuf;
     };
 }
 
@@ -0,0 +1,66 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef POLAR_SHADER_PIPELINE_PATTERNS_GRAYSCOTT_H
+#define POLAR_SHADER_PIPELINE_PATTERNS_GRAYSCOTT_H
+
+#include <cstdint>
+
+namespace PolarShader {
+    namespace grayscott {
+        // Q16 rates shared by ReactionDiffusionPattern and
+        // RasterReactionDiffusionPattern. du/dv/f/k must be below 65536.
+        struct Params {
+            int32_t du;
+            int32_t dv;
+            uint32_t f;
+            uint32_t k;
+        };
+
+        // One explicit Euler step of a row from its up/mid/down neighbours.
+        // Interior cells run in a branch-free loop with 32-bit products only,
+        // which compilers vectorise (the outputs are __restrict, so no alias
+        // checks); only the first and last columns wrap.
+        void stepRow(
+            const uint16_t *uUp, const uint16_t *uMid, const uint16_t *uDown,
+            const uint16_t *vUp, const uint16_t *vMid, const uint16_t *vDown,
+            uint16_t *__restrict uOut,
+            uint16_t *__restrict vOut,
+            uint16_t width,
+            Params p
+        );
+
+        // Steps rows [firstRow, endRow) of a toroidal width x height grid
+        // from u/v into uOut/vOut. Rows wrap once per row, not per cell.
+        void stepRows(
+            const uint16_t *u,
+            const uint16_t *v,
+            uint16_t *uOut,
+            uint16_t *vOut,
+            uint16_t width,
+            uint16_t height,
+            uint16_t firstRow,
+            uint16_t endRow,
+            Params p
+        );
+    }
+}
+
+#endif // POLAR_SHADER_PIPELINE_PATTERNS_GRAYSCOTT_H
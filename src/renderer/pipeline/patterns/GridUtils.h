@@ -161,29 +161,61 @@ namespace PolarShader {
 
         // ---- Lane advection ----
 
-        // Read from a shifted row or column with wrapped bilinear sampling along that single axis.
-        inline uint16_t sampleShiftedLaneWrapped(
-            const uint16_t *sourceCells,
+        /// Shift one row or column by laneShift cells with wrapping linear
+        /// interpolation: dest[d] = source[d - laneShift]. The shift is uniform
+        /// along the lane, so its whole-cell offset and blend fraction are
+        /// worked out once and the walk wraps by compare, not modulo.
+        template<bool ApplyFade>
+        inline void shiftLaneWrapped(
+            const uint16_t *source,
+            uint16_t *dest,
             size_t laneBaseIndex,
             size_t laneStride,
             uint8_t laneLength,
-            uint8_t destinationIndex,
-            fl::s16x16 laneShift
+            fl::s16x16 laneShift,
+            u0x16 fadeFactor
         ) {
-            int32_t laneSpanRaw = static_cast<int32_t>(laneLength) << kQ16Shift;
-            int32_t sampleCoordRaw = (static_cast<int32_t>(destinationIndex) << kQ16Shift) - raw(laneShift);
-            sampleCoordRaw %= laneSpanRaw;
-            if (sampleCoordRaw < 0) sampleCoordRaw += laneSpanRaw;
-            fl::s16x16 sampleCoord = fl::s16x16::from_raw(sampleCoordRaw);
-            uint8_t lowerIndex = static_cast<uint8_t>(raw(sampleCoord) >> kQ16Shift);
-            uint8_t upperIndex = static_cast<uint8_t>((lowerIndex + 1u) % laneLength);
-            u0x16 mix(static_cast<uint16_t>(raw(sampleCoord) & kQ16FractionMask));
-
-            return lerpU16ByQ16(
-                sourceCells[laneBaseIndex + static_cast<size_t>(lowerIndex) * laneStride],
-                sourceCells[laneBaseIndex + static_cast<size_t>(upperIndex) * laneStride],
-                mix
-            );
+            int32_t offsetRaw = -raw(laneShift);
+            u0x16 mix(static_cast<uint16_t>(offsetRaw & kQ16FractionMask));
+            int32_t lower = (offsetRaw >> kQ16Shift) % laneLength;
+            if (lower < 0) lower += laneLength;
+
+            const uint16_t *lane = source + laneBaseIndex;
+            uint16_t *out = dest + laneBaseIndex;
+            for (uint8_t index = 0; index < laneLength; ++index) {
+                int32_t upper = lower + 1 == laneLength ? 0 : lower + 1;
+                uint16_t value = lerpU16ByQ16(
+                    lane[static_cast<size_t>(lower) * laneStride],
+                    lane[static_cast<size_t>(upper) * laneStride],
+                    mix
+                );
+                if constexpr (ApplyFade) value = scaleU16ByU0x16(value, fadeFactor);
+                out[static_cast<size_t>(index) * laneStride] = value;
+                lower = upper;
+            }
+        }
+
+        /// Separable advection: shift each row y by rowShift(y) into rowPass,
+        /// then each column x by columnShift(x) back into cells, fading on the
+        /// way. The shift callables return fl::s16x16 cells and are template
+        /// parameters so they inline into the lane loops.
+        template<typename RowShift, typename ColumnShift>
+        inline void advectLanesWrapped(
+            uint16_t *cells,
+            uint16_t *rowPass,
+            uint8_t gridSize,
+            const RowShift &rowShift,
+            const ColumnShift &columnShift,
+            u0x16 fadeFactor
+        ) {
+            for (uint8_t y = 0; y < gridSize; ++y) {
+                shiftLaneWrapped<false>(
+                    cells, rowPass, static_cast<size_t>(y) * gridSize, 1u, gridSize, rowShift(y), fadeFactor
+                );
+            }
+            for (uint8_t x = 0; x < gridSize; ++x) {
+                shiftLaneWrapped<true>(rowPass, cells, x, gridSize, gridSize, columnShift(x), fadeFactor);
+            }
         }
 
         // ---- Grid scale helper ----
@@ -272,6 +304,30 @@ namespace PolarShader {
             22938u, 7307u
         };
 
+        /// Stamp subpixel points along a to b, kLineSampleDensity per cell of
+        /// length, then a soft disc on each endpoint.
+        inline void drawGlowingLine(
+            uint16_t *cells,
+            uint8_t gridSize,
+            fl::s16x16 ax,
+            fl::s16x16 ay,
+            fl::s16x16 bx,
+            fl::s16x16 by,
+            u0x16 intensity
+        ) {
+            int32_t dxRaw = raw(bx - ax);
+            int32_t dyRaw = raw(by - ay);
+            int32_t maxDelta = std::max(dxRaw < 0 ? -dxRaw : dxRaw, dyRaw < 0 ? -dyRaw : dyRaw);
+            int32_t steps = std::max<int32_t>(1, (maxDelta * kLineSampleDensity) >> kQ16Shift);
+            for (int32_t step = 0; step <= steps; ++step) {
+                uint32_t mixRaw = (static_cast<uint64_t>(step) * kFullIntensity) / static_cast<uint32_t>(steps);
+                u0x16 mix(static_cast<uint16_t>(mixRaw));
+                drawSubpixelPoint(cells, gridSize, lerpS16x16(ax, bx, mix), lerpS16x16(ay, by, mix), intensity);
+            }
+            drawEndpointGlow(cells, gridSize, ax, ay, intensity);
+            drawEndpointGlow(cells, gridSize, bx, by, intensity);
+        }
+
         /// Emit a Lissajous line + endpoint glows onto a scalar grid.
         /// speed is the emitter speed (fl::s16x16), timeQ16 is accumulated Q16.16 time.
         inline void emitLissajousLine(
@@ -291,20 +347,7 @@ namespace PolarShader {
             fl::s16x16 bx = gridCenter + mulS16x16(scaleByGridSize(gridSize, kLissajousEndpointB.xAmplitude), angleSinU0x16(bXPh));
             fl::s16x16 by = gridCenter + mulS16x16(scaleByGridSize(gridSize, kLissajousEndpointB.yAmplitude), angleSinU0x16(bYPh));
 
-            fl::s16x16 ldx = bx - ax;
-            fl::s16x16 ldy = by - ay;
-            int32_t maxDelta = std::max(
-                raw(ldx) < 0 ? -raw(ldx) : raw(ldx),
-                raw(ldy) < 0 ? -raw(ldy) : raw(ldy)
-            );
-            int32_t steps = std::max<int32_t>(1, (maxDelta * kLineSampleDensity) >> kQ16Shift);
-            for (int32_t step = 0; step <= steps; ++step) {
-                uint32_t mixRaw = (static_cast<uint64_t>(step) * kFullIntensity) / static_cast<uint32_t>(steps);
-                u0x16 mix(static_cast<uint16_t>(mixRaw));
-                drawSubpixelPoint(cells, gridSize, lerpS16x16(ax, bx, mix), lerpS16x16(ay, by, mix));
-            }
-            drawEndpointGlow(cells, gridSize, ax, ay, u0x16(kFullIntensity));
-            drawEndpointGlow(cells, gridSize, bx, by, u0x16(kFullIntensity));
+            drawGlowingLine(cells, gridSize, ax, ay, bx, by, u0x16(kFullIntensity));
         }
 
         // ---- 2D backward advection ----
@@ -341,29 +384,26 @@ namespace PolarShader {
             return lerpU16ByQ16(top, bot, u0x16(fy));
         }
 
-        /// Per-pixel 2D backward advection with per-pixel vector callback.
-        /// vectorFn returns displacement in Q16.16 grid-cell units.
-        using TransportVectorFn = Vec2I32(*)(
-            uint8_t x, uint8_t y, uint8_t gridSize, const void *params
-        );
-
+        /// Per-pixel 2D backward advection, fading as it goes. field(x, y, index)
+        /// returns the displacement at a cell in Q16.16 grid-cell units, where
+        /// index = y * gridSize + x; it is a template parameter so each caller
+        /// gets its own loop with the field inlined.
+        template<typename VectorField>
         inline void advectGrid2DBackward(
             const uint16_t *source,
             uint16_t *dest,
             uint8_t gridSize,
-            TransportVectorFn vectorFn,
-            const void *params,
+            const VectorField &field,
             u0x16 fadeFactor
         ) {
+            size_t index = 0;
             for (uint8_t y = 0; y < gridSize; ++y) {
                 int32_t yCenter = (static_cast<int32_t>(y) << kQ16Shift) + (S0X16_ONE >> 1);
-                for (uint8_t x = 0; x < gridSize; ++x) {
+                for (uint8_t x = 0; x < gridSize; ++x, ++index) {
                     int32_t xCenter = (static_cast<int32_t>(x) << kQ16Shift) + (S0X16_ONE >> 1);
-                    Vec2I32 disp = vectorFn(x, y, gridSize, params);
-                    int32_t srcX = xCenter - disp.x;
-                    int32_t srcY = yCenter - disp.y;
-                    uint16_t sampled = sampleGridBilinearWrapped(source, gridSize, srcX, srcY);
-                    dest[static_cast<size_t>(y) * gridSize + x] = scaleU16ByU0x16(sampled, fadeFactor);
+                    Vec2I32 disp = field(x, y, index);
+                    uint16_t sampled = sampleGridBilinearWrapped(source, gridSize, xCenter - disp.x, yCenter - disp.y);
+                    dest[index] = scaleU16ByU0x16(sampled, fadeFactor);
                 }
             }
         }
@@ -41,7 +41,8 @@ namespace PolarShader {
             uint16_t stepIntervalMs = 200,
             uint16_t seed = 0,
             uint16_t densityPermille = 350,
-            Rule rule = Rule::HighLife
+            Rule rule = Rule::HighLife,
+            bool timeSliced = false
         );
 
         RasterMap rasterLayer(const std::shared_ptr<PipelineContext>& context) const override;
@@ -51,14 +52,17 @@ namespace PolarShader {
         void release() const override;
         void seed(uint32_t generationSeed) const override;
         bool step() const override;
+        void stepRows(uint16_t stage, uint16_t firstRow, uint16_t endRow) const override;
+        bool finishStage(uint16_t stage) const override;
 
     private:
         uint16_t densityPermille;
         uint16_t birthMask;
         uint16_t survivalMask;
 
-        mutable std::unique_ptr<uint8_t[]> cells;
-        mutable std::unique_ptr<uint8_t[]> next;
+        // Bit-packed boards (raster::packedWordsPerRow).
+        mutable std::unique_ptr<uint32_t[]> cells;
+        mutable std::unique_ptr<uint32_t[]> next;
 
         static Rule clampRule(Rule rule);
         static uint16_t birthMaskFor(Rule rule);
@@ -29,6 +29,7 @@
 #endif
 #include "renderer/pipeline/patterns/base/UVPattern.h"
 #include "renderer/pipeline/maths/CartesianMaths.h"
+#include "renderer/pipeline/maths/NoiseMaths.h"
 #include "renderer/pipeline/signals/SignalTypes.h"
 
 namespace PolarShader {
@@ -67,14 +68,17 @@ namespace PolarShader {
         bool loopEnabled;
         uint16_t loopPeriodMs;
         State state;
+        bool latticeReuse{false};
 
-        static PatternNormU0x16 noiseLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z);
+        // `cache` may be null (no sample reuse, or no memo entries).
+        static PatternNormU0x16 noiseLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache);
 
-        static PatternNormU0x16 fBmLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, fl::u8 octaveCount);
+        static PatternNormU0x16 fBmLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, fl::u8 octaveCount,
+                                             NoiseLatticeCache *cache);
 
-        static PatternNormU0x16 turbulenceLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z);
+        static PatternNormU0x16 turbulenceLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache);
 
-        static PatternNormU0x16 ridgedLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z);
+        static PatternNormU0x16 ridgedLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache);
 
     public:
         explicit NoisePattern(
@@ -88,6 +92,17 @@ namespace PolarShader {
         void advanceFrame(u0x16 progress, TimeMillis elapsedMs) override;
 
         UVMap layer(const std::shared_ptr<PipelineContext> &context) const override;
+
+        UVLayer uvLayer(const std::shared_ptr<PipelineContext> &context) const override;
+
+        // Only layers that zoom or fold the plane reuse lattice columns, so
+        // only their samplers memoise them (NoiseLatticeCache).
+        void setSampleReuse(bool reused) override { latticeReuse = reused; }
+
+        bool needsPerCoreSampler() const override;
+
+        // Single-octave noise is smooth; the fractal types keep fine detail.
+        uint8_t bandwidthDivisor() const override;
     };
 }
 
@@ -29,7 +29,9 @@ namespace PolarShader {
     // and V diffuse and react (U + 2V -> 3V) with feed/kill terms; the V field
     // drives the display intensity. Different feed/kill presets settle into
     // spots, stripes, coral or worm textures. Deterministic per (seed,
-    // generation): reseeded automatically when the field saturates.
+    // generation): reseeded automatically when the field saturates. Each of a
+    // step's Gray-Scott iterations is a time-sliced stage by default, so the
+    // iterations are spread across frames instead of run back to back.
     class RasterReactionDiffusionPattern : public RasterAutomaton {
     public:
         enum class Preset : uint8_t {
@@ -43,7 +45,8 @@ namespace PolarShader {
             uint8_t preset = 0,
             uint16_t stepIntervalMs = 33,
             uint16_t seed = 0,
-            uint16_t iterationsPerStep = 4
+            uint16_t iterationsPerStep = 4,
+            bool timeSliced = true
         );
 
         RasterMap rasterLayer(const std::shared_ptr<PipelineContext>& context) const override;
@@ -53,9 +56,12 @@ namespace PolarShader {
         void release() const override;
         void seed(uint32_t generationSeed) const override;
         bool step() const override;
+        uint16_t stepStages() const override { return iterationsPerStep; }
+        void stepRows(uint16_t stage, uint16_t firstRow, uint16_t endRow) const override;
+        bool finishStage(uint16_t stage) const override;
 
     private:
-        void euler() const;
+        bool saturated() const;
 
         uint16_t f;
         uint16_t k;
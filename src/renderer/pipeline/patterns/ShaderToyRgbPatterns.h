@@ -32,6 +32,10 @@ namespace PolarShader {
      * They emit full RGB samples through UVLayer::Rgb. ShaderToy UI sliders,
      * where present, are represented by pattern-owned signals sampled once per
      * frame.
+     *
+     * Rocaille, Octgrams, RotatingSquares and StarryPlanes scale their loop
+     * counts by PipelineContext::quality, so a QualityGovernor can trade
+     * detail for frame rate on large displays.
      */
 
     // Port of https://www.shadertoy.com/view/sX2SzG
@@ -35,6 +35,9 @@ namespace PolarShader {
      * TransportMode values select the vector field: polar spirals, radial
      * sink/source, shockwaves, attractor fields, and more.
      *
+     * Polar modes cache each cell's radius and direction at construction
+     * (8 bytes per cell), and the advection loop is instantiated per mode.
+     *
      * Shares grid infrastructure (drawing, fade, emitter injection) with
      * FlurryPattern and FlowFieldPattern via GridUtils.h.
      */
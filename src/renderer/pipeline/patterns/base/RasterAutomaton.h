@@ -56,6 +56,34 @@ namespace PolarShader {
             uint16_t height,
             uint8_t targetState
         );
+
+        // Two-state boards are bit-packed: cell (x, y) is bit (x & 31) of word
+        // y * wordsPerRow + (x >> 5). Rows are padded to whole words and the
+        // padding bits are kept clear.
+        uint16_t packedWordsPerRow(uint16_t width);
+
+        bool packedCell(const uint32_t *board, uint16_t wordsPerRow, uint16_t x, uint16_t y);
+
+        void setPackedCell(uint32_t *board, uint16_t wordsPerRow, uint16_t x, uint16_t y, bool alive);
+
+        // Steps rows [firstRow, endRow) of a packed Life-like board (toroidal
+        // Moore neighbourhood) 32 cells at a time with bit-sliced neighbour
+        // counts. Bit n of birthMask / survivalMask admits a count of n.
+        // Returns true if any of those cells changed.
+        bool stepLifePacked(
+            const uint32_t *current,
+            uint32_t *next,
+            uint16_t width,
+            uint16_t height,
+            uint16_t birthMask,
+            uint16_t survivalMask,
+            uint16_t firstRow,
+            uint16_t endRow
+        );
+
+        // Applies an elementary (Wolfram) rule to one packed row of `width`
+        // cells, wrapping at the ends, 32 cells at a time.
+        void stepElementaryPacked(const uint32_t *row, uint32_t *out, uint16_t width, uint8_t rule);
     }
 
     /**
@@ -65,14 +93,24 @@ namespace PolarShader {
      * catch-up driver, and the deterministic reseed machinery. Subclasses own
      * their own cell buffers (of whatever element type they need) and supply
      * four hooks: allocate(), release(), seed() and step().
+     *
+     * Every step and reseed is recorded in a RasterChangeLog. A step() that
+     * reports nothing marks the whole board changed; one that calls
+     * markRowChanged()/markChangedRows() limits it to the rows it touched.
+     *
+     * A time-sliced pattern instead splits each step into stepStages()
+     * full-board stages computed a few rows at a time by stepRows(), and the
+     * driver spreads those rows across frames in proportion to elapsed time,
+     * so frame cost stays flat rather than spiking on catch-up steps.
      */
     class RasterAutomaton : public UVPattern {
     public:
         PatternDomain domain() const override { return PatternDomain::RasterGrid; }
         void advanceFrame(u0x16 progress, TimeMillis elapsedMs) override;
+        const RasterChangeLog *rasterChanges() const override { return grid.ready ? &changes : nullptr; }
 
     protected:
-        RasterAutomaton(uint16_t stepIntervalMs, uint16_t seed);
+        RasterAutomaton(uint16_t stepIntervalMs, uint16_t seed, bool timeSliced = false);
 
         // Reconcile the pattern with the current display. Call at the top of
         // rasterLayer()/rasterColourLayer() before sampling.
@@ -98,6 +136,34 @@ namespace PolarShader {
         // false triggers a deterministic reseed so the pattern never stalls.
         virtual bool step() const = 0;
 
+        // Time-sliced patterns only: full-board stages in one step.
+        virtual uint16_t stepStages() const { return 1; }
+
+        // Time-sliced patterns only: compute rows [firstRow, endRow) of
+        // `stage` into a back buffer, reading only the front buffer.
+        virtual void stepRows(uint16_t stage, uint16_t firstRow, uint16_t endRow) const {
+            (void) stage;
+            (void) firstRow;
+            (void) endRow;
+        }
+
+        // Time-sliced patterns only: every row of `stage` is done; swap the
+        // buffers. Returning false requests a reseed, as step() does.
+        virtual bool finishStage(uint16_t stage) const {
+            (void) stage;
+            return true;
+        }
+
+        // For step()/finishStage(): row y differs from the previous generation.
+        void markRowChanged(uint16_t y) const;
+
+        // For step()/finishStage(): marks the rows where two width*height
+        // boards of one-byte cells differ. Returns true if any row does.
+        bool markChangedRows(const uint8_t *before, const uint8_t *after) const;
+
+        // As above, for bit-packed boards (see raster::packedWordsPerRow).
+        bool markChangedRows(const uint32_t *before, const uint32_t *after) const;
+
     private:
         struct Grid {
             bool ready{false};
@@ -110,16 +176,28 @@ namespace PolarShader {
         };
 
         mutable Grid grid;
+        mutable RasterChangeLog changes;
+        mutable bool rowsMarked{false};
         mutable bool hasLastElapsed{false};
         mutable TimeMillis lastElapsedMs{0};
         mutable TimeMillis accumulatedMs{0};
+        // Time-sliced driver: earned work in row-milliseconds (a row costs
+        // stepIntervalMs) and rows of the current step already computed.
+        mutable uint64_t sliceCredit{0};
+        mutable uint32_t sliceRow{0};
         mutable uint32_t baseSeed{0};
         mutable uint32_t generation{0};
         uint16_t stepIntervalMs;
         uint16_t seedParam;
+        bool timeSliced;
 
         void seedInitial() const;
         void reseed() const;
+        void advanceGeneration() const;
+        bool publishStage(uint16_t stage) const;
+        void advanceSliced(TimeMillis deltaMs) const;
+        void advanceRows(uint32_t count) const;
+        void markAllRowsChanged() const;
     };
 }
 
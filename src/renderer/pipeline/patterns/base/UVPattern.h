@@ -31,6 +31,20 @@ namespace PolarShader {
         RasterGrid
     };
 
+    /**
+     * @brief Change stamps of a stateful raster pattern's board.
+     *
+     * `generation` moves on every step or reseed; `rows[y]` holds the
+     * generation at which row y last changed, so a caller that remembers the
+     * stamp it sampled a cell at can tell whether the cell is still current.
+     */
+    struct RasterChangeLog {
+        uint32_t generation{0};
+        uint16_t width{0};
+        uint16_t height{0};
+        std::unique_ptr<uint32_t[]> rows;
+    };
+
     /**
      * @brief Standard interface for all spatial patterns in the unified UV pipeline.
      */
@@ -76,11 +90,49 @@ namespace PolarShader {
             return {};
         }
 
+        /**
+         * @brief Whether each render core needs its own compiled sampler.
+         *
+         * Scene::compile() builds one sampler shared by all cores, relying on
+         * it being read-only. A pattern whose sampler writes scratch state
+         * during render returns true to get a separate instance per core.
+         */
+        virtual bool needsPerCoreSampler() const { return false; }
+
+        /**
+         * @brief Told by Layer whether any UV step repeats samples
+         * (UVTransform::repeatsSamples). Without one, neighbouring pixels
+         * rarely share pattern work, so memoising samplers can skip it.
+         */
+        virtual void setSampleReuse(bool reused) { (void) reused; }
+
+        /**
+         * @brief Declared bandwidth, as the largest raster divisor the
+         * pattern survives being sampled at and bilinearly upsampled from.
+         *
+         * Smooth fields return 2 or more; Layer::renderDivisor() only acts on
+         * it for layers without UV transforms, which could raise the spatial
+         * frequency.
+         */
+        virtual uint8_t bandwidthDivisor() const { return 1; }
+
+        /**
+         * @brief Board change stamps, or null when the pattern keeps none.
+         *
+         * Only raster patterns whose samples depend on nothing but their
+         * board return a log; Layer::compileSpan() then reuses the colours of
+         * cells in rows that have not changed since they were last sampled.
+         */
+        virtual const RasterChangeLog *rasterChanges() const { return nullptr; }
+
     protected:
         UVPattern();
 
         explicit UVPattern(UVMap layer);
 
+        // PipelineContext::quality of the owning layer, for advanceFrame().
+        u0x16 renderQuality() const;
+
     private:
         std::shared_ptr<PipelineContext> context;
         UVMap layerValue;
@@ -65,6 +65,9 @@ namespace PolarShader {
 
         UVColourMap colourLayer(const std::shared_ptr<PipelineContext> &context) const override;
 
+        // Plasma is a handful of low-frequency waves; the other variants draw thin edges.
+        uint8_t bandwidthDivisor() const override;
+
     private:
         struct State;
         struct Functor;
@@ -182,6 +182,10 @@ namespace PolarShader {
         return true;
     }
 
+    uint8_t PfPlasmaWarp::bandwidthDivisor() const {
+        return state->variant == Variant::Plasma ? 2 : 1;
+    }
+
     UVColourMap PfPlasmaWarp::colourLayer(const std::shared_ptr<PipelineContext> &context) const {
         (void)context;
         return [f = Functor{state.get()}](UV uv) { return f.sample(uv); };
@@ -37,18 +37,19 @@ namespace PolarShader {
         }
 
         void accumulateLiveNeighbour(
-            const uint8_t *current,
+            const uint32_t *cells,
             const uint8_t *hues,
-            uint32_t idx,
-            uint8_t &neighbours,
+            uint16_t words,
+            uint16_t x,
+            uint16_t y,
+            uint16_t width,
             uint8_t &hueCount,
             uint8_t &baseHue,
             int16_t &deltaSum
         ) {
-            if (current[idx] == 0) return;
+            if (!raster::packedCell(cells, words, x, y)) return;
 
-            ++neighbours;
-            const uint8_t hue = hues[idx];
+            const uint8_t hue = hues[static_cast<uint32_t>(y) * width + x];
             if (hueCount == 0) {
                 baseHue = hue;
             } else {
@@ -62,86 +63,84 @@ namespace PolarShader {
             return static_cast<uint8_t>(static_cast<int16_t>(baseHue) + (deltaSum / hueCount));
         }
 
-        bool stepCellsAndHues(
-            const uint8_t *current,
+        // Hue a cell born at (x, y) inherits from its live neighbours on the
+        // current board.
+        uint8_t birthHue(
+            const uint32_t *cells,
             const uint8_t *hues,
-            uint8_t *next,
-            uint8_t *nextHues,
+            uint16_t x,
+            uint16_t y,
             uint16_t width,
             uint16_t height
         ) {
-            if (!current || !hues || !next || !nextHues || width == 0 || height == 0) return false;
-
-            bool changed = false;
-
-            for (uint16_t y = 0; y < height; ++y) {
-                const uint16_t yUp = y == 0 ? static_cast<uint16_t>(height - 1) : static_cast<uint16_t>(y - 1);
-                const uint16_t yDown = y == height - 1 ? 0 : static_cast<uint16_t>(y + 1);
-
-                for (uint16_t x = 0; x < width; ++x) {
-                    const uint16_t xLeft = x == 0 ? static_cast<uint16_t>(width - 1) : static_cast<uint16_t>(x - 1);
-                    const uint16_t xRight = x == width - 1 ? 0 : static_cast<uint16_t>(x + 1);
-                    const uint32_t idx = static_cast<uint32_t>(y) * width + x;
-
-                    uint8_t neighbours = 0;
-                    uint8_t hueCount = 0;
-                    uint8_t baseHue = hues[idx];
-                    int16_t deltaSum = 0;
-
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(yUp) * width + xLeft,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(yUp) * width + x,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(yUp) * width + xRight,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(y) * width + xLeft,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(y) * width + xRight,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(yDown) * width + xLeft,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(yDown) * width + x,
-                                             neighbours, hueCount, baseHue, deltaSum);
-                    accumulateLiveNeighbour(current, hues, static_cast<uint32_t>(yDown) * width + xRight,
-                                             neighbours, hueCount, baseHue, deltaSum);
-
-                    const bool alive = current[idx] != 0;
-                    const bool nextAlive = neighbours == 3 || (alive && neighbours == 2);
-                    next[idx] = nextAlive ? 1u : 0u;
-                    changed = changed || nextAlive != alive;
-
-                    if (!nextAlive) {
-                        nextHues[idx] = 0;
-                    } else if (alive) {
-                        nextHues[idx] = hues[idx];
-                    } else {
-                        nextHues[idx] = averagedHue(baseHue, deltaSum, hueCount);
+            const uint16_t words = raster::packedWordsPerRow(width);
+            const uint16_t yUp = y == 0 ? static_cast<uint16_t>(height - 1) : static_cast<uint16_t>(y - 1);
+            const uint16_t yDown = y == height - 1 ? 0 : static_cast<uint16_t>(y + 1);
+            const uint16_t xLeft = x == 0 ? static_cast<uint16_t>(width - 1) : static_cast<uint16_t>(x - 1);
+            const uint16_t xRight = x == width - 1 ? 0 : static_cast<uint16_t>(x + 1);
+
+            uint8_t hueCount = 0;
+            uint8_t baseHue = hues[static_cast<uint32_t>(y) * width + x];
+            int16_t deltaSum = 0;
+            accumulateLiveNeighbour(cells, hues, words, xLeft, yUp, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, x, yUp, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, xRight, yUp, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, xLeft, y, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, xRight, y, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, xLeft, yDown, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, x, yDown, width, hueCount, baseHue, deltaSum);
+            accumulateLiveNeighbour(cells, hues, words, xRight, yDown, width, hueCount, baseHue, deltaSum);
+            return averagedHue(baseHue, deltaSum, hueCount);
+        }
+
+        // Updates the hue plane in place for the cells that differ between
+        // the packed boards: births first, as they read the hues of cells that
+        // may be dying, then deaths.
+        void updateHues(
+            const uint32_t *current,
+            const uint32_t *next,
+            uint8_t *hues,
+            uint16_t width,
+            uint16_t height
+        ) {
+            const uint16_t words = raster::packedWordsPerRow(width);
+            for (uint8_t pass = 0; pass < 2; ++pass) {
+                for (uint16_t y = 0; y < height; ++y) {
+                    for (uint16_t w = 0; w < words; ++w) {
+                        const uint32_t idx = static_cast<uint32_t>(y) * words + w;
+                        uint32_t diff = (current[idx] ^ next[idx]) & (pass == 0 ? next[idx] : current[idx]);
+                        while (diff) {
+                            const uint8_t bit = static_cast<uint8_t>(__builtin_ctz(diff));
+                            diff &= diff - 1u;
+                            const uint16_t x = static_cast<uint16_t>((w << 5) + bit);
+                            hues[static_cast<uint32_t>(y) * width + x] =
+                                pass == 0 ? birthHue(current, hues, x, y, width, height) : 0u;
+                        }
                     }
                 }
             }
-            return changed;
         }
     }
 
     ConwayPattern::ConwayPattern(
         uint16_t stepIntervalMs,
         uint16_t seed,
-        uint16_t densityPermille
-    ) : RasterAutomaton(stepIntervalMs, seed),
+        uint16_t densityPermille,
+        bool timeSliced
+    ) : RasterAutomaton(stepIntervalMs, seed, timeSliced),
         densityPermille(raster::clampPermille(densityPermille)) {
     }
 
-    bool ConwayPattern::allocate(uint16_t, uint16_t, uint32_t cellCount) const {
-        std::unique_ptr<uint8_t[]> newCells(new (std::nothrow) uint8_t[cellCount]);
-        std::unique_ptr<uint8_t[]> newNext(new (std::nothrow) uint8_t[cellCount]);
+    bool ConwayPattern::allocate(uint16_t width, uint16_t height, uint32_t cellCount) const {
+        const uint32_t words = static_cast<uint32_t>(raster::packedWordsPerRow(width)) * height;
+        std::unique_ptr<uint32_t[]> newCells(new (std::nothrow) uint32_t[words]);
+        std::unique_ptr<uint32_t[]> newNext(new (std::nothrow) uint32_t[words]);
         std::unique_ptr<uint8_t[]> newHues(new (std::nothrow) uint8_t[cellCount]);
-        std::unique_ptr<uint8_t[]> newNextHues(new (std::nothrow) uint8_t[cellCount]);
-        if (!newCells || !newNext || !newHues || !newNextHues) return false;
+        if (!newCells || !newNext || !newHues) return false;
 
         cells = std::move(newCells);
         next = std::move(newNext);
         hues = std::move(newHues);
-        nextHues = std::move(newNextHues);
         return true;
     }
 
@@ -149,32 +148,52 @@ namespace PolarShader {
         cells.reset();
         next.reset();
         hues.reset();
-        nextHues.reset();
     }
 
     void ConwayPattern::seed(uint32_t generationSeed) const {
-        if (!cells || !next || !hues || !nextHues) return;
+        if (!cells || !next || !hues) return;
 
         uint32_t cellRng = generationSeed == 0 ? 0xA5A5A5A5u : generationSeed;
         uint32_t hueRng = cellRng ^ 0x9E3779B9u;
         if (hueRng == 0) hueRng = 0x6D2B79F5u;
-        const uint32_t count = cellCount();
-        for (uint32_t i = 0; i < count; ++i) {
-            const uint16_t roll = static_cast<uint16_t>((raster::lcgNext(cellRng) >> 16) % 1000u);
-            const uint8_t hue = static_cast<uint8_t>(raster::lcgNext(hueRng) >> 24);
-            cells[i] = roll < densityPermille ? 1u : 0u;
+        const uint16_t words = raster::packedWordsPerRow(width());
+        const uint32_t wordCount = static_cast<uint32_t>(words) * height();
+        for (uint32_t i = 0; i < wordCount; ++i) {
+            cells[i] = 0u;
             next[i] = 0u;
-            hues[i] = cells[i] ? hue : 0u;
-            nextHues[i] = 0u;
+        }
+        for (uint16_t y = 0; y < height(); ++y) {
+            for (uint16_t x = 0; x < width(); ++x) {
+                const uint16_t roll = static_cast<uint16_t>((raster::lcgNext(cellRng) >> 16) % 1000u);
+                const uint8_t hue = static_cast<uint8_t>(raster::lcgNext(hueRng) >> 24);
+                const bool alive = roll < densityPermille;
+                raster::setPackedCell(cells.get(), words, x, y, alive);
+                hues[static_cast<uint32_t>(y) * width() + x] = alive ? hue : 0u;
+            }
         }
     }
 
     bool ConwayPattern::step() const {
-        if (!stepCellsAndHues(cells.get(), hues.get(), next.get(), nextHues.get(), width(), height())) {
-            return false;
-        }
+        if (!cells || !next || !hues || width() == 0 || height() == 0) return false;
+
+        stepRows(0, 0, height());
+        return finishStage(0);
+    }
+
+    void ConwayPattern::stepRows(uint16_t, uint16_t firstRow, uint16_t endRow) const {
+        if (!cells || !next) return;
+
+        constexpr uint16_t birth = 1u << 3;
+        constexpr uint16_t survival = (1u << 2) | (1u << 3);
+        raster::stepLifePacked(cells.get(), next.get(), width(), height(), birth, survival, firstRow, endRow);
+    }
+
+    bool ConwayPattern::finishStage(uint16_t) const {
+        if (!cells || !next || !hues) return false;
+        if (!markChangedRows(cells.get(), next.get())) return false;
+
+        updateHues(cells.get(), next.get(), hues.get(), width(), height());
         cells.swap(next);
-        hues.swap(nextHues);
         return true;
     }
 
@@ -189,8 +208,9 @@ namespace PolarShader {
                 return PatternNormU0x16(0);
             }
 
-            const uint32_t idx = static_cast<uint32_t>(point.y) * width() + point.x;
-            return cells[idx] ? PatternNormU0x16(U0X16_MAX) : PatternNormU0x16(0);
+            return raster::packedCell(cells.get(), raster::packedWordsPerRow(width()), point.x, point.y)
+                       ? PatternNormU0x16(U0X16_MAX)
+                       : PatternNormU0x16(0);
         };
     }
 
@@ -205,11 +225,11 @@ namespace PolarShader {
                 return PaletteSample{};
             }
 
-            const uint32_t idx = static_cast<uint32_t>(point.y) * width() + point.x;
-            if (!cells[idx]) {
+            if (!raster::packedCell(cells.get(), raster::packedWordsPerRow(width()), point.x, point.y)) {
                 return PaletteSample{};
             }
 
+            const uint32_t idx = static_cast<uint32_t>(point.y) * width() + point.x;
             return PaletteSample{
                 PatternNormU0x16(raster::hue8ToPatternRaw(hues[idx])),
                 PatternNormU0x16(U0X16_MAX)
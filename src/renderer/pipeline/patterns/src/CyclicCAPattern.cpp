@@ -95,6 +95,7 @@ namespace PolarShader {
                 }
             }
         }
+        markChangedRows(cells.get(), next.get());
         cells.swap(next);
         return changed;
     }
@@ -37,9 +37,10 @@ namespace PolarShader {
         rule(rule) {
     }
 
-    bool ElementaryCAPattern::allocate(uint16_t width, uint16_t, uint32_t cellCount) const {
-        std::unique_ptr<uint8_t[]> newCells(new (std::nothrow) uint8_t[cellCount]);
-        std::unique_ptr<uint8_t[]> newRow(new (std::nothrow) uint8_t[width]);
+    bool ElementaryCAPattern::allocate(uint16_t width, uint16_t height, uint32_t) const {
+        const uint16_t words = raster::packedWordsPerRow(width);
+        std::unique_ptr<uint32_t[]> newCells(new (std::nothrow) uint32_t[static_cast<uint32_t>(words) * height]);
+        std::unique_ptr<uint32_t[]> newRow(new (std::nothrow) uint32_t[words]);
         if (!newCells || !newRow) return false;
 
         cells = std::move(newCells);
@@ -55,55 +56,49 @@ namespace PolarShader {
     void ElementaryCAPattern::seed(uint32_t generationSeed) const {
         if (!cells) return;
 
-        const uint32_t count = cellCount();
-        for (uint32_t i = 0; i < count; ++i) cells[i] = 0u;
+        const uint16_t words = raster::packedWordsPerRow(width());
+        const uint32_t wordCount = static_cast<uint32_t>(words) * height();
+        for (uint32_t i = 0; i < wordCount; ++i) cells[i] = 0u;
 
         // Seed only the bottom row so history can grow upward from it.
         uint32_t rng = generationSeed == 0 ? 0xA5A5A5A5u : generationSeed;
-        const uint32_t bottom = static_cast<uint32_t>(height() - 1) * width();
+        const uint16_t bottom = static_cast<uint16_t>(height() - 1);
         for (uint16_t x = 0; x < width(); ++x) {
-            cells[bottom + x] = static_cast<uint8_t>((raster::lcgNext(rng) >> 16) & 1u);
+            raster::setPackedCell(cells.get(), words, x, bottom, (raster::lcgNext(rng) >> 16) & 1u);
         }
     }
 
     bool ElementaryCAPattern::step() const {
         if (!cells || !rowBuf || width() == 0 || height() == 0) return false;
 
-        const uint16_t w = width();
+        const uint16_t words = raster::packedWordsPerRow(width());
         const uint16_t h = height();
-        const uint32_t bottom = static_cast<uint32_t>(h - 1) * w;
-
-        bool changed = false;
-        for (uint16_t x = 0; x < w; ++x) {
-            const uint16_t xLeft = x == 0 ? static_cast<uint16_t>(w - 1) : static_cast<uint16_t>(x - 1);
-            const uint16_t xRight = x == w - 1 ? 0 : static_cast<uint16_t>(x + 1);
-            const uint8_t triple = static_cast<uint8_t>(
-                (cells[bottom + xLeft] << 2) |
-                (cells[bottom + x] << 1) |
-                cells[bottom + xRight]);
-            const uint8_t newCell = static_cast<uint8_t>((rule >> triple) & 1u);
-            rowBuf[x] = newCell;
-            changed = changed || newCell != cells[bottom + x];
-        }
-
-        // The bottom row can reach a fixed point (e.g. all-zero) while the
-        // accumulated history is still scrolling up the display. Only report
-        // "no change" — which triggers a reseed that erases the grid — once the
-        // grid is genuinely static: every row uniform and the bottom row stable.
-        if (!changed) {
-            for (uint16_t y = 0; y + 1 < h && !changed; ++y) {
-                const uint32_t rowOff = static_cast<uint32_t>(y) * w;
-                for (uint16_t x = 0; x < w; ++x) {
-                    if (cells[rowOff + x] != cells[bottom + x]) { changed = true; break; }
-                }
+        const uint32_t bottom = static_cast<uint32_t>(h - 1) * words;
+        const size_t rowBytes = static_cast<size_t>(words) * sizeof(uint32_t);
+
+        raster::stepElementaryPacked(cells.get() + bottom, rowBuf.get(), width(), rule);
+        bool changed = std::memcmp(rowBuf.get(), cells.get() + bottom, rowBytes) != 0;
+        if (changed) markRowChanged(static_cast<uint16_t>(h - 1));
+
+        // Each row takes the one below it, so a row changes exactly when it
+        // differs from that row. The bottom row can reach a fixed point (e.g.
+        // all-zero) while the accumulated history is still scrolling up the
+        // display. Only report "no change" — which triggers a reseed that
+        // erases the grid — once the grid is genuinely static: every row
+        // uniform and the bottom row stable.
+        for (uint16_t y = 0; y + 1 < h; ++y) {
+            const uint32_t *row = cells.get() + static_cast<uint32_t>(y) * words;
+            if (std::memcmp(row, row + words, rowBytes) != 0) {
+                markRowChanged(y);
+                changed = true;
             }
         }
 
         // Scroll every row up by one, then drop the freshly computed row in.
         if (h > 1) {
-            std::memmove(cells.get(), cells.get() + w, static_cast<size_t>(bottom));
+            std::memmove(cells.get(), cells.get() + words, static_cast<size_t>(bottom) * sizeof(uint32_t));
         }
-        std::memcpy(cells.get() + bottom, rowBuf.get(), w);
+        std::memcpy(cells.get() + bottom, rowBuf.get(), rowBytes);
         return changed;
     }
 
@@ -118,8 +113,9 @@ namespace PolarShader {
                 return PatternNormU0x16(0);
             }
 
-            const uint32_t idx = static_cast<uint32_t>(point.y) * width() + point.x;
-            return cells[idx] ? PatternNormU0x16(U0X16_MAX) : PatternNormU0x16(0);
+            return raster::packedCell(cells.get(), raster::packedWordsPerRow(width()), point.x, point.y)
+                       ? PatternNormU0x16(U0X16_MAX)
+                       : PatternNormU0x16(0);
         };
     }
 }
@@ -20,6 +20,7 @@
 
 #include "renderer/pipeline/patterns/FlowFieldPattern.h"
 #include "renderer/pipeline/patterns/GridUtils.h"
+#include "renderer/pipeline/maths/ScalarMaths.h"
 #include "renderer/pipeline/signals/ranges/BipolarRange.h"
 #include "renderer/pipeline/signals/ranges/MagnitudeRange.h"
 #include "ProfileRanges.h"
@@ -84,7 +85,7 @@ namespace PolarShader {
                 if (halfWidthRaw == 0) halfWidthRaw = 1;
                 int32_t deltaRaw = posRaw - raw(center);
                 // x in [-1, 1] as Q16.16
-                int32_t xRaw = (static_cast<int64_t>(deltaRaw) << 16) / halfWidthRaw;
+                int32_t xRaw = static_cast<int32_t>(divI64(static_cast<int64_t>(deltaRaw) << 16, halfWidthRaw));
                 if (xRaw < -(1 << 16) || xRaw > (1 << 16)) return s0x16(0);
 
                 int32_t shapedRaw;
@@ -346,30 +347,17 @@ namespace PolarShader {
             }
         }
 
-        // 6. Advect: row-pass then column-pass.
-        uint16_t *rowPass = s.rowPass.get();
-
-        for (uint8_t y = 0; y < gridSize; ++y) {
-            fl::s16x16 rowShift = mulS16x16(kRowShiftPixels, s.rowShiftProfile[y]);
-            size_t rowBaseIndex = static_cast<size_t>(y) * gridSize;
-            for (uint8_t x = 0; x < gridSize; ++x) {
-                rowPass[rowBaseIndex + x] = sampleShiftedLaneWrapped(
-                    cells, rowBaseIndex, 1u, gridSize, x, rowShift
-                );
-            }
-        }
-
-        // 7. Column-pass + fade using half-life.
-        u0x16 fadeFactor = halfLifeFade(dtMs, s.halfLifeMs);
-        for (uint8_t x = 0; x < gridSize; ++x) {
-            fl::s16x16 columnShift = mulS16x16(kColShiftPixels, s.columnShiftProfile[x]);
-            for (uint8_t y = 0; y < gridSize; ++y) {
-                uint16_t advected = sampleShiftedLaneWrapped(
-                    rowPass, x, gridSize, gridSize, y, columnShift
-                );
-                cells[static_cast<size_t>(y) * gridSize + x] = scaleU16ByU0x16(advected, fadeFactor);
-            }
-        }
+        // 6. Advect: row-pass then column-pass, fading by half-life.
+        const s0x16 *rowShiftProfile = s.rowShiftProfile.get();
+        const s0x16 *columnShiftProfile = s.columnShiftProfile.get();
+        advectLanesWrapped(
+            cells,
+            s.rowPass.get(),
+            gridSize,
+            [rowShiftProfile](uint8_t y) { return mulS16x16(kRowShiftPixels, rowShiftProfile[y]); },
+            [columnShiftProfile](uint8_t x) { return mulS16x16(kColShiftPixels, columnShiftProfile[x]); },
+            halfLifeFade(dtMs, s.halfLifeMs)
+        );
     }
 
     // ---- layer ----
@@ -271,65 +271,20 @@ namespace PolarShader {
                     lineIntensity
                 );
             } else {
-                fl::s16x16 lineDeltaX = endpointBX - endpointAX;
-                fl::s16x16 lineDeltaY = endpointBY - endpointAY;
-                int32_t lineDeltaXRaw = raw(lineDeltaX);
-                int32_t lineDeltaYRaw = raw(lineDeltaY);
-                int32_t maxLineDelta = std::max(
-                    lineDeltaXRaw < 0 ? -lineDeltaXRaw : lineDeltaXRaw,
-                    lineDeltaYRaw < 0 ? -lineDeltaYRaw : lineDeltaYRaw
-                );
-                int32_t lineStepCount = std::max<int32_t>(1, (maxLineDelta * kLineSampleDensity) >> kQ16Shift);
-                for (int32_t step = 0; step <= lineStepCount; ++step) {
-                    uint32_t mixRaw = static_cast<uint32_t>(
-                        (static_cast<uint64_t>(step) * kFullIntensity) / static_cast<uint32_t>(lineStepCount)
-                    );
-                    u0x16 mix(static_cast<uint16_t>(mixRaw));
-                    drawSubpixelPoint(
-                        cells,
-                        gridSize,
-                        lerpS16x16(endpointAX, endpointBX, mix),
-                        lerpS16x16(endpointAY, endpointBY, mix),
-                        lineIntensity
-                    );
-                }
-
-                drawEndpointGlow(cells, gridSize, endpointAX, endpointAY, lineIntensity);
-                drawEndpointGlow(cells, gridSize, endpointBX, endpointBY, lineIntensity);
-            }
-        }
-
-        uint16_t *rowPass = patternState.rowPass.get();
-
-        for (uint8_t y = 0; y < gridSize; ++y) {
-            fl::s16x16 rowShift = mulS16x16(kRowShiftPixels, patternState.rowShiftProfile[y]);
-            size_t rowBaseIndex = static_cast<size_t>(y) * gridSize;
-            for (uint8_t x = 0; x < gridSize; ++x) {
-                rowPass[rowBaseIndex + x] = sampleShiftedLaneWrapped(
-                    cells,
-                    rowBaseIndex,
-                    1u,
-                    gridSize,
-                    x,
-                    rowShift
-                );
+                drawGlowingLine(cells, gridSize, endpointAX, endpointAY, endpointBX, endpointBY, lineIntensity);
             }
         }
 
-        for (uint8_t x = 0; x < gridSize; ++x) {
-            fl::s16x16 columnShift = mulS16x16(kColShiftPixels, patternState.columnShiftProfile[x]);
-            for (uint8_t y = 0; y < gridSize; ++y) {
-                uint16_t advected = sampleShiftedLaneWrapped(
-                    rowPass,
-                    x,
-                    gridSize,
-                    gridSize,
-                    y,
-                    columnShift
-                );
-                cells[static_cast<size_t>(y) * gridSize + x] = scaleU16ByU0x16(advected, patternState.fadeFactor);
-            }
-        }
+        const s0x16 *rowShiftProfile = patternState.rowShiftProfile.get();
+        const s0x16 *columnShiftProfile = patternState.columnShiftProfile.get();
+        advectLanesWrapped(
+            cells,
+            patternState.rowPass.get(),
+            gridSize,
+            [rowShiftProfile](uint8_t y) { return mulS16x16(kRowShiftPixels, rowShiftProfile[y]); },
+            [columnShiftProfile](uint8_t x) { return mulS16x16(kColShiftPixels, columnShiftProfile[x]); },
+            patternState.fadeFactor
+        );
     }
 
     UVMap FlurryPattern::layer(const std::shared_ptr<PipelineContext> &context) const {
@@ -109,6 +109,7 @@ namespace PolarShader {
                 changed = changed || result != current;
             }
         }
+        markChangedRows(cells.get(), next.get());
         cells.swap(next);
         return changed;
     }
@@ -0,0 +1,117 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderer/pipeline/patterns/GrayScott.h"
+#include <algorithm>
+
+namespace PolarShader {
+    namespace grayscott {
+        namespace {
+            // (rate * value) >> 16 in 32-bit arithmetic, exact for rate <
+            // 65536 and |value| < 2^30: the low 16 bits of value are scaled
+            // unsigned and the small high part is added back whole.
+            inline int32_t mulQ16(int32_t rate, int32_t value) {
+                const uint32_t low = static_cast<uint32_t>(value) & 0xFFFFu;
+                return rate * (value >> 16) + static_cast<int32_t>((static_cast<uint32_t>(rate) * low) >> 16);
+            }
+
+            inline uint16_t clampU16(int32_t value) {
+                return static_cast<uint16_t>(std::min<int32_t>(std::max<int32_t>(value, 0), 65535));
+            }
+
+            // Updates one cell given the sum of its four neighbours. u, v and
+            // u*v >> 16 are all below 2^16, so every product fits 32 bits.
+            inline void stepCell(
+                int32_t u,
+                int32_t v,
+                int32_t uNeighbours,
+                int32_t vNeighbours,
+                const Params &p,
+                uint32_t fk,
+                uint16_t &uOut,
+                uint16_t &vOut
+            ) {
+                const int32_t diffU = mulQ16(p.du, uNeighbours - 4 * u);
+                const int32_t diffV = mulQ16(p.dv, vNeighbours - 4 * v);
+
+                // Reaction: U * V^2 in Q16.
+                const uint32_t uv = (static_cast<uint32_t>(u) * static_cast<uint32_t>(v)) >> 16;
+                const int32_t uv2 = static_cast<int32_t>((uv * static_cast<uint32_t>(v)) >> 16);
+
+                // Feed and kill terms.
+                const int32_t feed = static_cast<int32_t>((p.f * static_cast<uint32_t>(65536 - u)) >> 16);
+                const int32_t kill = static_cast<int32_t>((fk * static_cast<uint32_t>(v)) >> 16);
+
+                uOut = clampU16(u + diffU - uv2 + feed);
+                vOut = clampU16(v + diffV + uv2 - kill);
+            }
+        }
+
+        void stepRow(
+            const uint16_t *uUp, const uint16_t *uMid, const uint16_t *uDown,
+            const uint16_t *vUp, const uint16_t *vMid, const uint16_t *vDown,
+            uint16_t *__restrict uOut,
+            uint16_t *__restrict vOut,
+            uint16_t width,
+            Params p
+        ) {
+            if (width == 0) return;
+            const uint32_t fk = p.f + p.k;
+            const uint16_t last = width - 1;
+
+            const auto border = [&](uint16_t x, uint16_t left, uint16_t right) {
+                stepCell(uMid[x], vMid[x],
+                         static_cast<int32_t>(uMid[left]) + uMid[right] + uUp[x] + uDown[x],
+                         static_cast<int32_t>(vMid[left]) + vMid[right] + vUp[x] + vDown[x],
+                         p, fk, uOut[x], vOut[x]);
+            };
+
+            border(0, last, width > 1 ? 1 : 0);
+            for (uint16_t x = 1; x < last; ++x) {
+                stepCell(uMid[x], vMid[x],
+                         static_cast<int32_t>(uMid[x - 1]) + uMid[x + 1] + uUp[x] + uDown[x],
+                         static_cast<int32_t>(vMid[x - 1]) + vMid[x + 1] + vUp[x] + vDown[x],
+                         p, fk, uOut[x], vOut[x]);
+            }
+            if (last > 0) border(last, last - 1, 0);
+        }
+
+        void stepRows(
+            const uint16_t *u,
+            const uint16_t *v,
+            uint16_t *uOut,
+            uint16_t *vOut,
+            uint16_t width,
+            uint16_t height,
+            uint16_t firstRow,
+            uint16_t endRow,
+            Params p
+        ) {
+            for (uint16_t y = firstRow; y < endRow; ++y) {
+                const uint32_t mid = static_cast<uint32_t>(y) * width;
+                const uint32_t up = static_cast<uint32_t>(y == 0 ? height - 1 : y - 1) * width;
+                const uint32_t down = static_cast<uint32_t>(y + 1 == height ? 0 : y + 1) * width;
+                stepRow(u + up, u + mid, u + down,
+                        v + up, v + mid, v + down,
+                        uOut + mid, vOut + mid, width, p);
+            }
+        }
+    }
+}
@@ -93,6 +93,7 @@ namespace PolarShader {
                 ant.dir = static_cast<uint8_t>((ant.dir + 3u) & 0x3u);
                 cells[idx] = 1u;
             }
+            markRowChanged(ant.y);
 
             switch (ant.dir) {
                 case 0: // up
@@ -66,16 +66,18 @@ namespace PolarShader {
         uint16_t stepIntervalMs,
         uint16_t seed,
         uint16_t densityPermille,
-        Rule rule
-    ) : RasterAutomaton(stepIntervalMs, seed),
+        Rule rule,
+        bool timeSliced
+    ) : RasterAutomaton(stepIntervalMs, seed, timeSliced),
         densityPermille(raster::clampPermille(densityPermille)),
         birthMask(birthMaskFor(clampRule(rule))),
         survivalMask(survivalMaskFor(clampRule(rule))) {
     }
 
-    bool LifeVariantPattern::allocate(uint16_t, uint16_t, uint32_t cellCount) const {
-        std::unique_ptr<uint8_t[]> newCells(new (std::nothrow) uint8_t[cellCount]);
-        std::unique_ptr<uint8_t[]> newNext(new (std::nothrow) uint8_t[cellCount]);
+    bool LifeVariantPattern::allocate(uint16_t width, uint16_t height, uint32_t) const {
+        const uint32_t words = static_cast<uint32_t>(raster::packedWordsPerRow(width)) * height;
+        std::unique_ptr<uint32_t[]> newCells(new (std::nothrow) uint32_t[words]);
+        std::unique_ptr<uint32_t[]> newNext(new (std::nothrow) uint32_t[words]);
         if (!newCells || !newNext) return false;
 
         cells = std::move(newCells);
@@ -92,30 +94,36 @@ namespace PolarShader {
         if (!cells || !next) return;
 
         uint32_t rng = generationSeed == 0 ? 0xA5A5A5A5u : generationSeed;
-        const uint32_t count = cellCount();
-        for (uint32_t i = 0; i < count; ++i) {
-            const uint16_t roll = static_cast<uint16_t>((raster::lcgNext(rng) >> 16) % 1000u);
-            cells[i] = roll < densityPermille ? 1u : 0u;
+        const uint16_t words = raster::packedWordsPerRow(width());
+        const uint32_t wordCount = static_cast<uint32_t>(words) * height();
+        for (uint32_t i = 0; i < wordCount; ++i) {
+            cells[i] = 0u;
             next[i] = 0u;
         }
+        for (uint16_t y = 0; y < height(); ++y) {
+            for (uint16_t x = 0; x < width(); ++x) {
+                const uint16_t roll = static_cast<uint16_t>((raster::lcgNext(rng) >> 16) % 1000u);
+                raster::setPackedCell(cells.get(), words, x, y, roll < densityPermille);
+            }
+        }
     }
 
     bool LifeVariantPattern::step() const {
         if (!cells || !next || width() == 0 || height() == 0) return false;
 
-        bool changed = false;
-        for (uint16_t y = 0; y < height(); ++y) {
-            for (uint16_t x = 0; x < width(); ++x) {
-                const uint32_t idx = static_cast<uint32_t>(y) * width() + x;
-                const uint8_t neighbours =
-                    raster::countMooreState(cells.get(), x, y, width(), height(), 1u);
-                const bool alive = cells[idx] != 0;
-                const uint16_t mask = alive ? survivalMask : birthMask;
-                const bool nextAlive = (mask & countBit(neighbours)) != 0;
-                next[idx] = nextAlive ? 1u : 0u;
-                changed = changed || nextAlive != alive;
-            }
-        }
+        stepRows(0, 0, height());
+        return finishStage(0);
+    }
+
+    void LifeVariantPattern::stepRows(uint16_t, uint16_t firstRow, uint16_t endRow) const {
+        if (!cells || !next) return;
+        raster::stepLifePacked(cells.get(), next.get(), width(), height(), birthMask, survivalMask, firstRow, endRow);
+    }
+
+    bool LifeVariantPattern::finishStage(uint16_t) const {
+        if (!cells || !next) return false;
+
+        const bool changed = markChangedRows(cells.get(), next.get());
         cells.swap(next);
         return changed;
     }
@@ -131,8 +139,9 @@ namespace PolarShader {
                 return PatternNormU0x16(0);
             }
 
-            const uint32_t idx = static_cast<uint32_t>(point.y) * width() + point.x;
-            return cells[idx] ? PatternNormU0x16(U0X16_MAX) : PatternNormU0x16(0);
+            return raster::packedCell(cells.get(), raster::packedWordsPerRow(width()), point.x, point.y)
+                       ? PatternNormU0x16(U0X16_MAX)
+                       : PatternNormU0x16(0);
         };
     }
 }
@@ -45,12 +45,29 @@ namespace PolarShader {
         uint32_t random32Seed() {
             return (static_cast<uint32_t>(random16()) << 16) | random16();
         }
+
+        // One memo per compiled sampler, so each render core gets its own.
+        std::shared_ptr<NoiseLatticeCache> makeLatticeCache(bool latticeReuse) {
+#if POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES
+            if (latticeReuse) return std::make_shared<NoiseLatticeCache>();
+#else
+            (void) latticeReuse;
+#endif
+            return nullptr;
+        }
+
+        NoiseRawU0x16 sampleLattice(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache) {
+            return cache
+                       ? sampleNoiseTrilinear(x.raw(), y.raw(), z.raw(), *cache)
+                       : sampleNoiseTrilinear(x.raw(), y.raw(), z.raw());
+        }
     }
 
     struct NoisePattern::UVNoisePatternFunctor {
         NoiseType type;
         fl::u8 octaves;
         const State *state;
+        std::shared_ptr<NoiseLatticeCache> cache;
 
         PatternNormU0x16 operator()(UV uv) const {
             uint32_t offset = NOISE_DOMAIN_OFFSET << 8;
@@ -68,8 +85,8 @@ namespace PolarShader {
             if (state && state->loopActive && type == NoiseType::Basic) {
                 fl::u24x8 zuA = fl::u24x8::from_raw(state->depthA + offset);
                 fl::u24x8 zuB = fl::u24x8::from_raw(state->depthB + offset);
-                const uint32_t a = raw(noiseLayerImpl(xu, yu, zuA));
-                const uint32_t b = raw(noiseLayerImpl(xu, yu, zuB));
+                const uint32_t a = raw(noiseLayerImpl(xu, yu, zuA, cache.get()));
+                const uint32_t b = raw(noiseLayerImpl(xu, yu, zuB, cache.get()));
                 int64_t out = static_cast<int64_t>(a) +
                     (((static_cast<int64_t>(b) - static_cast<int64_t>(a)) *
                       static_cast<int64_t>(state->blendWeight)) >> 16);
@@ -80,27 +97,28 @@ namespace PolarShader {
 
             switch (type) {
                 case NoiseType::FBM:
-                    return fBmLayerImpl(xu, yu, zu, octaves);
+                    return fBmLayerImpl(xu, yu, zu, octaves, cache.get());
                 case NoiseType::Turbulence:
-                    return turbulenceLayerImpl(xu, yu, zu);
+                    return turbulenceLayerImpl(xu, yu, zu, cache.get());
                 case NoiseType::Ridged:
-                    return ridgedLayerImpl(xu, yu, zu);
+                    return ridgedLayerImpl(xu, yu, zu, cache.get());
                 case NoiseType::Basic:
                 default:
-                    return noiseLayerImpl(xu, yu, zu);
+                    return noiseLayerImpl(xu, yu, zu, cache.get());
             }
         }
     };
 
-    PatternNormU0x16 NoisePattern::noiseLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z) {
-        return noiseNormaliseU16(sampleNoiseTrilinear(x.raw(), y.raw(), z.raw()));
+    PatternNormU0x16 NoisePattern::noiseLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache) {
+        return noiseNormaliseU16(sampleLattice(x, y, z, cache));
     }
 
-    PatternNormU0x16 NoisePattern::fBmLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, fl::u8 octaveCount) {
+    PatternNormU0x16 NoisePattern::fBmLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, fl::u8 octaveCount,
+                                               NoiseLatticeCache *cache) {
         uint32_t r = 0;
         uint16_t amplitude = U16_HALF;
         for (int o = 0; o < octaveCount; o++) {
-            auto n = sampleNoiseTrilinear(x.raw(), y.raw(), z.raw());
+            auto n = sampleLattice(x, y, z, cache);
             r += (static_cast<uint32_t>(raw(n)) * amplitude) >> 16;
             x = fl::u24x8::from_raw(x.raw() << 1);
             y = fl::u24x8::from_raw(y.raw() << 1);
@@ -111,8 +129,8 @@ namespace PolarShader {
         return noiseNormaliseU16(NoiseRawU0x16(static_cast<uint16_t>(r)));
     }
 
-    PatternNormU0x16 NoisePattern::turbulenceLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z) {
-        NoiseRawU0x16 noise_raw = NoiseRawU0x16(sampleNoiseTrilinear(x.raw(), y.raw(), z.raw()));
+    PatternNormU0x16 NoisePattern::turbulenceLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache) {
+        NoiseRawU0x16 noise_raw = sampleLattice(x, y, z, cache);
         int16_t r = static_cast<int16_t>(raw(noise_raw)) - U16_HALF;
         uint16_t mag = static_cast<uint16_t>(r ^ (r >> 15)) - static_cast<uint16_t>(r >> 15);
         uint32_t doubled = static_cast<uint32_t>(mag) << 1;
@@ -120,8 +138,8 @@ namespace PolarShader {
         return noiseNormaliseU16(NoiseRawU0x16(static_cast<uint16_t>(doubled)));
     }
 
-    PatternNormU0x16 NoisePattern::ridgedLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z) {
-        NoiseRawU0x16 noise_raw = NoiseRawU0x16(sampleNoiseTrilinear(x.raw(), y.raw(), z.raw()));
+    PatternNormU0x16 NoisePattern::ridgedLayerImpl(fl::u24x8 x, fl::u24x8 y, fl::u24x8 z, NoiseLatticeCache *cache) {
+        NoiseRawU0x16 noise_raw = sampleLattice(x, y, z, cache);
         int16_t r = static_cast<int16_t>(raw(noise_raw)) - U16_HALF;
         uint16_t mag = static_cast<uint16_t>(r ^ (r >> 15)) - static_cast<uint16_t>(r >> 15);
         mag = std::min(mag, static_cast<uint16_t>(U16_HALF - 1));
@@ -213,6 +231,20 @@ namespace PolarShader {
 
     UVMap NoisePattern::layer(const std::shared_ptr<PipelineContext> &context) const {
         (void) context;
-        return UVNoisePatternFunctor{type, octaves, &state};
+        return UVNoisePatternFunctor{type, octaves, &state, makeLatticeCache(latticeReuse)};
+    }
+
+    UVLayer NoisePattern::uvLayer(const std::shared_ptr<PipelineContext> &context) const {
+        (void) context;
+        // Functor leaf: inlines the noise sampler into the span loop.
+        return UVLayer::fromScalar(UVNoisePatternFunctor{type, octaves, &state, makeLatticeCache(latticeReuse)});
+    }
+
+    bool NoisePattern::needsPerCoreSampler() const {
+        return POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES != 0 && latticeReuse;
+    }
+
+    uint8_t NoisePattern::bandwidthDivisor() const {
+        return type == NoiseType::Basic ? 2 : 1;
     }
 }
@@ -82,7 +82,7 @@ namespace PolarShader {
             if (maxChannel == 0u) return PatternNormU0x16(0);
             if (maxChannel > U0X16_MAX) return PatternNormU0x16(clampAccumToU16(channel));
 
-            uint64_t scaled = (static_cast<uint64_t>(channel) << 16) / maxChannel;
+            uint64_t scaled = divU64(static_cast<uint64_t>(channel) << 16, maxChannel);
             if (scaled > U0X16_MAX) scaled = U0X16_MAX;
             return PatternNormU0x16(static_cast<uint16_t>(scaled));
         }
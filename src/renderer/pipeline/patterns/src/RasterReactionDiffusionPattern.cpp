@@ -24,6 +24,7 @@
 #include "native/Arduino.h"
 #endif
 
+#include "renderer/pipeline/patterns/GrayScott.h"
 #include "renderer/pipeline/patterns/RasterReactionDiffusionPattern.h"
 #include <new>
 
@@ -64,8 +65,9 @@ namespace PolarShader {
         uint8_t preset,
         uint16_t stepIntervalMs,
         uint16_t seed,
-        uint16_t iterationsPerStep
-    ) : RasterAutomaton(stepIntervalMs, seed),
+        uint16_t iterationsPerStep,
+        bool timeSliced
+    ) : RasterAutomaton(stepIntervalMs, seed, timeSliced),
         iterationsPerStep(clampIterations(iterationsPerStep)) {
         const uint8_t index = preset < kRrdPresetCount ? preset : 0u;
         f = kRrdPresets[index].f;
@@ -124,90 +126,53 @@ namespace PolarShader {
         saturatedStreak = 0u;
     }
 
-    void RasterReactionDiffusionPattern::euler() const {
-        const uint16_t W = width();
-        const uint16_t H = height();
-        const uint32_t fk = static_cast<uint32_t>(f) + k;
-        const uint16_t *U = u.get();
-        const uint16_t *V = v.get();
-        uint16_t *Un = uNext.get();
-        uint16_t *Vn = vNext.get();
-
-        for (uint16_t y = 0; y < H; ++y) {
-            for (uint16_t x = 0; x < W; ++x) {
-                const uint32_t idx = static_cast<uint32_t>(y) * W + x;
-                const uint32_t il = static_cast<uint32_t>(x == 0 ? W - 1 : x - 1) + static_cast<uint32_t>(y) * W;
-                const uint32_t ir = static_cast<uint32_t>(x == W - 1 ? 0 : x + 1) + static_cast<uint32_t>(y) * W;
-                const uint32_t iu = static_cast<uint32_t>(x) + static_cast<uint32_t>(y == 0 ? H - 1 : y - 1) * W;
-                const uint32_t id = static_cast<uint32_t>(x) + static_cast<uint32_t>(y == H - 1 ? 0 : y + 1) * W;
-
-                const int32_t uu = U[idx];
-                const int32_t vv = V[idx];
-
-                // 4-neighbour Laplacian with toroidal wrap.
-                const int32_t lap_u = static_cast<int32_t>(U[il]) + U[ir] + U[iu] + U[id] - 4 * uu;
-                const int32_t lap_v = static_cast<int32_t>(V[il]) + V[ir] + V[iu] + V[id] - 4 * vv;
-
-                // Diffusion: Du * lap_u, Dv * lap_v (Q16 multiply).
-                const int32_t diff_u = static_cast<int32_t>((static_cast<int64_t>(RRD_DU) * lap_u) >> 16);
-                const int32_t diff_v = static_cast<int32_t>((static_cast<int64_t>(RRD_DV) * lap_v) >> 16);
-
-                // Reaction: U * V^2 in Q16.
-                const int32_t uv = static_cast<int32_t>((static_cast<uint64_t>(static_cast<uint32_t>(uu)) * static_cast<uint32_t>(vv)) >> 16);
-                const int32_t uv2 = static_cast<int32_t>((static_cast<uint64_t>(static_cast<uint32_t>(uv)) * static_cast<uint32_t>(vv)) >> 16);
-
-                // Feed and kill terms.
-                const int32_t f_term = static_cast<int32_t>((static_cast<uint32_t>(f) * static_cast<uint32_t>(65536 - uu)) >> 16);
-                const int32_t fk_v = static_cast<int32_t>((fk * static_cast<uint32_t>(vv)) >> 16);
-
-                // Euler step and clamp to [0, 65535].
-                int32_t new_u = uu + diff_u - uv2 + f_term;
-                int32_t new_v = vv + diff_v + uv2 - fk_v;
-
-                if (new_u < 0) new_u = 0;
-                else if (new_u > 65535) new_u = 65535;
-                if (new_v < 0) new_v = 0;
-                else if (new_v > 65535) new_v = 65535;
-
-                Un[idx] = static_cast<uint16_t>(new_u);
-                Vn[idx] = static_cast<uint16_t>(new_v);
-            }
-        }
+    void RasterReactionDiffusionPattern::stepRows(uint16_t, uint16_t firstRow, uint16_t endRow) const {
+        if (!u || !v || !uNext || !vNext) return;
 
-        u.swap(uNext);
-        v.swap(vNext);
+        // One Euler iteration for the rows, from u/v into uNext/vNext.
+        grayscott::stepRows(u.get(), v.get(), uNext.get(), vNext.get(),
+                            width(), height(), firstRow, endRow, {RRD_DU, RRD_DV, f, k});
     }
 
-    bool RasterReactionDiffusionPattern::step() const {
-        if (!u || !v || width() == 0 || height() == 0) return false;
+    bool RasterReactionDiffusionPattern::finishStage(uint16_t stage) const {
+        if (!u || !v || !uNext || !vNext) return false;
 
-        for (uint16_t i = 0; i < iterationsPerStep; ++i) {
-            euler();
-        }
+        u.swap(uNext);
+        v.swap(vNext);
+        if (stage + 1u < iterationsPerStep) return true;
 
         // Detect a saturated (flat) field: reseed once it has persisted.
+        if (saturated()) {
+            if (++saturatedStreak >= RRD_SATURATION_STREAK) {
+                saturatedStreak = 0u;
+                return false; // Trigger a deterministic reseed.
+            }
+        } else {
+            saturatedStreak = 0u;
+        }
+        return true;
+    }
+
+    bool RasterReactionDiffusionPattern::saturated() const {
         const uint16_t *V = v.get();
         const uint32_t count = cellCount();
         uint16_t minV = 65535u;
         uint16_t maxV = 0u;
-        bool active = false;
         for (uint32_t i = 0; i < count; ++i) {
             const uint16_t value = V[i];
             if (value < minV) minV = value;
             if (value > maxV) maxV = value;
-            if (maxV - minV >= RRD_SATURATION_DELTA) {
-                active = true;
-                break;
-            }
+            if (maxV - minV >= RRD_SATURATION_DELTA) return false;
         }
+        return true;
+    }
 
-        if (!active) {
-            if (++saturatedStreak >= RRD_SATURATION_STREAK) {
-                saturatedStreak = 0u;
-                return false; // Trigger a deterministic reseed.
-            }
-        } else {
-            saturatedStreak = 0u;
+    bool RasterReactionDiffusionPattern::step() const {
+        if (!u || !v || width() == 0 || height() == 0) return false;
+
+        for (uint16_t i = 0; i < iterationsPerStep; ++i) {
+            stepRows(i, 0, height());
+            if (!finishStage(i)) return false;
         }
         return true;
     }
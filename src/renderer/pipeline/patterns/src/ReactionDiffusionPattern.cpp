@@ -25,6 +25,7 @@
 #endif
 #include <algorithm>
 #include "renderer/pipeline/maths/PatternMaths.h"
+#include "renderer/pipeline/patterns/GrayScott.h"
 #include "renderer/pipeline/patterns/ReactionDiffusionPattern.h"
 
 namespace PolarShader {
@@ -103,55 +104,8 @@ namespace PolarShader {
     }
 
     void ReactionDiffusionPattern::step(State &s) {
-        const uint8_t W = s.width;
-        const uint8_t H = s.height;
-        const uint32_t fk = s.f + s.k;
-        const uint16_t *U = s.u.get();
-        const uint16_t *V = s.v.get();
-        uint16_t *Un = s.u_next.get();
-        uint16_t *Vn = s.v_next.get();
-
-        for (uint8_t y = 0; y < H; ++y) {
-            for (uint8_t x = 0; x < W; ++x) {
-                const uint16_t idx = (uint16_t) y * W + x;
-                const uint16_t il = (uint16_t) (x == 0 ? W - 1 : x - 1) + (uint16_t) y * W;
-                const uint16_t ir = (uint16_t) (x == W - 1 ? 0 : x + 1) + (uint16_t) y * W;
-                const uint16_t iu = (uint16_t) x + (uint16_t) (y == 0 ? H - 1 : y - 1) * W;
-                const uint16_t id = (uint16_t) x + (uint16_t) (y == H - 1 ? 0 : y + 1) * W;
-
-                const int32_t u = U[idx];
-                const int32_t v = V[idx];
-
-                // 4-neighbour Laplacian with toroidal wrap.
-                const int32_t lap_u = (int32_t) U[il] + U[ir] + U[iu] + U[id] - 4 * u;
-                const int32_t lap_v = (int32_t) V[il] + V[ir] + V[iu] + V[id] - 4 * v;
-
-                // Diffusion: Du * lap_u, Dv * lap_v (Q16 multiply, int64 to avoid overflow).
-                const int32_t diff_u = (int32_t) (((int64_t) s.du * lap_u) >> 16);
-                const int32_t diff_v = (int32_t) (((int64_t) s.dv * lap_v) >> 16);
-
-                // Reaction: U * V^2 in Q16.
-                const int32_t uv = (int32_t) (((uint64_t) (uint32_t) u * (uint32_t) v) >> 16);
-                const int32_t uv2 = (int32_t) (((uint64_t) (uint32_t) uv * (uint32_t) v) >> 16);
-
-                // Feed and kill terms.
-                const int32_t f_term = (int32_t) ((s.f * (uint32_t) (65536 - u)) >> 16);
-                const int32_t fk_v = (int32_t) ((fk * (uint32_t) v) >> 16);
-
-                // Euler step and clamp to [0, 65535].
-                int32_t new_u = u + diff_u - uv2 + f_term;
-                int32_t new_v = v + diff_v + uv2 - fk_v;
-
-                if (new_u < 0) new_u = 0;
-                else if (new_u > 65535) new_u = 65535;
-                if (new_v < 0) new_v = 0;
-                else if (new_v > 65535) new_v = 65535;
-
-                Un[idx] = (uint16_t) new_u;
-                Vn[idx] = (uint16_t) new_v;
-            }
-        }
-
+        grayscott::stepRows(s.u.get(), s.v.get(), s.u_next.get(), s.v_next.get(),
+                            s.width, s.height, 0, s.height, {s.du, s.dv, s.f, s.k});
         s.u.swap(s.u_next);
         s.v.swap(s.v_next);
     }
@@ -123,6 +123,15 @@ namespace PolarShader {
             return context->rasterDisplay.width;
         }
 
+        // Scales a loop's full iteration count by the render quality, rounding
+        // up so full quality keeps every iteration, and never below `floor`.
+        uint8_t qualityIterations(uint8_t full, uint8_t floor, u0x16 quality) {
+            uint32_t n = (static_cast<uint32_t>(full) * raw(quality) + 0xFFFFu) >> 16;
+            if (n < floor) n = floor;
+            if (n > full) n = full;
+            return static_cast<uint8_t>(n);
+        }
+
         fl::s16x16 shaderToyAxis(fl::s16x16 axis) {
             int64_t centred = static_cast<int64_t>(raw(axis)) * 2 - S0X16_ONE;
             return fl::s16x16::from_raw(clampRaw(centred, INT32_MIN, INT32_MAX));
@@ -130,13 +139,13 @@ namespace PolarShader {
 
         int32_t divSignedRaw(int32_t numRaw, int32_t denRaw, int32_t maxAbsRaw = INT32_MAX) {
             if (denRaw == 0) return numRaw < 0 ? -maxAbsRaw : maxAbsRaw;
-            int64_t value = (static_cast<int64_t>(numRaw) << 16) / denRaw;
+            int64_t value = divI64(static_cast<int64_t>(numRaw) << 16, denRaw);
             return clampRaw(value, -maxAbsRaw, maxAbsRaw);
         }
 
         uint32_t divUnsignedRaw(uint32_t numRaw, uint32_t denRaw, uint32_t maxRaw) {
             if (denRaw == 0u) return maxRaw;
-            uint64_t value = (static_cast<uint64_t>(numRaw) << 16) / denRaw;
+            uint64_t value = divU64(static_cast<uint64_t>(numRaw) << 16, denRaw);
             return value > maxRaw ? maxRaw : static_cast<uint32_t>(value);
         }
 
@@ -300,7 +309,7 @@ namespace PolarShader {
         PatternNormU0x16 shaderToyUnpremultiplyChannel(uint32_t channel, uint32_t maxChannel) {
             if (maxChannel == 0u) return PatternNormU0x16(0);
             if (maxChannel > U0X16_MAX) return PatternNormU0x16(shaderToyClampAccumToU16(channel));
-            uint64_t scaled = (static_cast<uint64_t>(channel) << 16) / maxChannel;
+            uint64_t scaled = divU64(static_cast<uint64_t>(channel) << 16, maxChannel);
             if (scaled > U0X16_MAX) scaled = U0X16_MAX;
             return PatternNormU0x16(static_cast<uint16_t>(scaled));
         }
@@ -750,6 +759,17 @@ namespace PolarShader {
         uint32_t speedRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_3_00, signalUnitRaw(state->speedSignal, elapsedMs, 333)));
         state->timeRaw = mulUnsignedRaw(secondsRaw(elapsedMs), speedRaw);
         state->layers = lerpIntByUnit(1, 12, signalUnitRaw(state->layersSignal, elapsedMs, 727));
+        // Cost is layers x detail: thin the turbulence first, then drop layers
+        // to stay within the same share of the full product.
+        const u0x16 quality = renderQuality();
+        if (raw(quality) != U0X16_MAX) {
+            const uint32_t budget =
+                    (static_cast<uint32_t>(state->layers) * state->detail * raw(quality) + 0xFFFFu) >> 16;
+            state->detail = qualityIterations(state->detail, 2, quality);
+            uint32_t layers = budget / state->detail;
+            if (layers < 1) layers = 1;
+            if (layers < state->layers) state->layers = static_cast<uint8_t>(layers);
+        }
         state->hueRaw = lerpByUnitRaw(-Q16_PI, Q16_PI, signalUnitRaw(state->hueSignal, elapsedMs, 500));
         state->glowRaw = static_cast<uint32_t>(lerpByUnitRaw(Q16_0_25, Q16_2_00, signalUnitRaw(state->glowSignal, elapsedMs, 429)));
     }
@@ -869,6 +889,7 @@ namespace PolarShader {
         uint32_t pulseRaw{S0X16_ONE};
         uint32_t densityRaw{Q16_23_00};
         uint32_t glowRaw{Q16_0_02};
+        uint8_t marchSteps{99};
 
         State(S0x16Signal speed, S0x16Signal travel, S0x16Signal pulse, S0x16Signal density, S0x16Signal glow)
             : speedSignal(std::move(speed)),
@@ -904,7 +925,7 @@ namespace PolarShader {
             uint32_t tRaw = Q16_0_10;
             uint32_t acRaw = 0;
 
-            for (uint8_t i = 0; i < 99; ++i) {
+            for (uint8_t i = 0; i < state->marchSteps; ++i) {
                 Vec3Q16 pos{
                     fl::s16x16::from_raw(raw(ro.x) + mulQ16Raw(raw(ray.x), static_cast<int32_t>(tRaw))),
                     fl::s16x16::from_raw(raw(ro.y) + mulQ16Raw(raw(ray.y), static_cast<int32_t>(tRaw))),
@@ -961,6 +982,8 @@ namespace PolarShader {
         state->pulseRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_2_00, signalUnitRaw(state->pulseSignal, elapsedMs, 500)));
         state->densityRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_46_00, signalUnitRaw(state->densitySignal, elapsedMs, 500)));
         state->glowRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_0_04, signalUnitRaw(state->glowSignal, elapsedMs, 500)));
+        // Fewer steps shorten the view distance; the near field is unchanged.
+        state->marchSteps = qualityIterations(99, 16, renderQuality());
     }
 
     UVMap OctgramsPattern::layer(const std::shared_ptr<PipelineContext> &context) const {
@@ -983,6 +1006,7 @@ namespace PolarShader {
         int32_t thicknessRaw{Q16_0_05};
         int32_t pulseRaw{Q16_0_01};
         uint32_t brightnessRaw{S0X16_ONE};
+        uint8_t squares{50};
 
         State(S0x16Signal speed, S0x16Signal thickness, S0x16Signal pulse, S0x16Signal brightness)
             : speedSignal(std::move(speed)),
@@ -1003,7 +1027,9 @@ namespace PolarShader {
             uint32_t pixelBlur = (static_cast<uint32_t>(2) << 16) / (width == 0 ? 128u : width);
 
             for (uint8_t j = 0; j < 3; ++j) {
-                for (uint8_t i = 0; i < 50; ++i) {
+                for (uint8_t k = 0; k < state->squares; ++k) {
+                    // Reduced quality keeps squares evenly spread over the full 0..49 run.
+                    const uint8_t i = static_cast<uint8_t>((static_cast<uint16_t>(k) * 49u) / (state->squares - 1u));
                     uint32_t diRaw = (static_cast<uint32_t>(i) << 16) / 49u;
                     uint32_t phaseOffset = static_cast<uint32_t>(j) * 3277u;
                     uint16_t exponentPermille = static_cast<uint16_t>(2000u + (static_cast<uint32_t>(i) * 1000u) / 49u);
@@ -1070,6 +1096,7 @@ namespace PolarShader {
         state->thicknessRaw = lerpByUnitRaw(Q16_0_02, Q16_0_10, signalUnitRaw(state->thicknessSignal, elapsedMs, 375));
         state->pulseRaw = lerpByUnitRaw(0, Q16_0_03, signalUnitRaw(state->pulseSignal, elapsedMs, 333));
         state->brightnessRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_2_00, signalUnitRaw(state->brightnessSignal, elapsedMs, 500)));
+        state->squares = qualityIterations(50, 8, renderQuality());
     }
 
     UVMap RotatingSquaresPattern::layer(const std::shared_ptr<PipelineContext> &context) const {
@@ -1094,6 +1121,7 @@ namespace PolarShader {
         int32_t starRadiusRaw{29491};
         uint32_t pathRaw{S0X16_ONE};
         uint32_t brightnessRaw{S0X16_ONE};
+        uint8_t planes{16};
 
         State(
             S0x16Signal speed,
@@ -1160,7 +1188,7 @@ namespace PolarShader {
             uint32_t accA = 0;
             int32_t accumulatedDistance = 0;
 
-            for (uint8_t i = 1; i <= 16; ++i) {
+            for (uint8_t i = 1; i <= state->planes; ++i) {
                 if (accA > 62259u) break; // 0.95
 
                 int32_t pzRaw = spacingRaw * (nz + static_cast<int32_t>(i));
@@ -1271,6 +1299,8 @@ namespace PolarShader {
         state->starRadiusRaw = lerpByUnitRaw(Q16_0_25, Q16_0_75, signalUnitRaw(state->starSizeSignal, elapsedMs, 400));
         state->pathRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_2_00, signalUnitRaw(state->pathSignal, elapsedMs, 500)));
         state->brightnessRaw = static_cast<uint32_t>(lerpByUnitRaw(0, Q16_2_00, signalUnitRaw(state->brightnessSignal, elapsedMs, 500)));
+        // Planes past the eighth are already fading in, so they go first.
+        state->planes = qualityIterations(16, 6, renderQuality());
     }
 
     UVMap StarryPlanesPattern::layer(const std::shared_ptr<PipelineContext> &context) const {
@@ -20,6 +20,7 @@
 
 #include "renderer/pipeline/patterns/TransportPattern.h"
 #include "renderer/pipeline/patterns/GridUtils.h"
+#include "renderer/pipeline/maths/ScalarMaths.h"
 #include "renderer/pipeline/signals/ranges/MagnitudeRange.h"
 #include "HalfLifeRange.h"
 #include <algorithm>
@@ -59,18 +60,22 @@ namespace PolarShader {
             static const MagnitudeRange range(fl::s16x16::from_raw(0), s16x16FromFraction(1, 4));
             return range;
         }
+    }
 
+    // Named rather than anonymous: State holds a table of PolarCoord.
+    namespace transport {
         // ---- Polar coordinate helpers ----
 
+        // Cell geometry relative to the grid centre. cos/sin keep sin16's Q1.15
+        // output, so a cached table entry is 8 bytes and loses nothing.
         struct PolarCoord {
             int32_t radiusRaw; // Q16.16, distance from center in grid cells
-            u0x16 angle;         // u0x16 turns [0, 65535] = [0, 2pi)
-            int32_t cosA;      // s0x16 raw of cos(angle)
-            int32_t sinA;      // s0x16 raw of sin(angle)
+            int16_t cosQ15;    // cos(angle); s0x16 raw is cosQ15 << 1
+            int16_t sinQ15;    // sin(angle); s0x16 raw is sinQ15 << 1
         };
 
         // Convert grid cell (x, y) to polar relative to grid center.
-        // Returns radius in Q16.16 grid-cell units, angle as u0x16.
+        // Returns radius in Q16.16 grid-cell units.
         PolarCoord gridToPolar(uint8_t x, uint8_t y, uint8_t gridSize) {
             int32_t halfRaw = (static_cast<int32_t>(gridSize - 1u) << kQ16Shift) >> 1;
             int32_t dxRaw = (static_cast<int32_t>(x) << kQ16Shift) + (S0X16_ONE >> 1) - halfRaw;
@@ -105,11 +110,28 @@ namespace PolarShader {
 
             u0x16 angle = angleAtan2TurnsApprox(dyScaled, dxScaled);
 
-            int32_t cosA = raw(angleCosU0x16(angle));
-            int32_t sinA = raw(angleSinU0x16(angle));
+            return PolarCoord{
+                radiusRaw,
+                static_cast<int16_t>(raw(angleCosU0x16(angle)) >> 1),
+                static_cast<int16_t>(raw(angleSinU0x16(angle)) >> 1)
+            };
+        }
 
-            return PolarCoord{radiusRaw, angle, cosA, sinA};
+        // The geometry depends only on gridSize, so it is computed once per
+        // pattern rather than per cell per frame.
+        void buildPolarTable(PolarCoord *table, uint8_t gridSize) {
+            for (uint8_t y = 0; y < gridSize; ++y) {
+                for (uint8_t x = 0; x < gridSize; ++x) {
+                    *table++ = gridToPolar(x, y, gridSize);
+                }
+            }
         }
+    }
+
+    namespace {
+        using transport::PolarCoord;
+        using transport::buildPolarTable;
+        using transport::gridToPolar;
 
         // Convert polar displacement (dr, dTheta) to cartesian (dx, dy) in Q16.16.
         // dr is Q16.16 grid-cell units, dTheta is Q16.16 radians-like (but we use turns).
@@ -117,23 +139,28 @@ namespace PolarShader {
         Vec2I32 polarToCartesian(const PolarCoord &polar, int32_t drRaw, int32_t dThetaRaw) {
             // dx = dr * cos(a) - r * dTheta * sin(a)
             // dy = dr * sin(a) + r * dTheta * cos(a)
-            int32_t drCos = static_cast<int32_t>((static_cast<int64_t>(drRaw) * polar.cosA) >> 16);
-            int32_t drSin = static_cast<int32_t>((static_cast<int64_t>(drRaw) * polar.sinA) >> 16);
+            int32_t cosA = static_cast<int32_t>(polar.cosQ15) << 1;
+            int32_t sinA = static_cast<int32_t>(polar.sinQ15) << 1;
+            int32_t drCos = static_cast<int32_t>((static_cast<int64_t>(drRaw) * cosA) >> 16);
+            int32_t drSin = static_cast<int32_t>((static_cast<int64_t>(drRaw) * sinA) >> 16);
             int32_t rDTheta = static_cast<int32_t>((static_cast<int64_t>(polar.radiusRaw) * dThetaRaw) >> 16);
-            int32_t rDThetaSin = static_cast<int32_t>((static_cast<int64_t>(rDTheta) * polar.sinA) >> 16);
-            int32_t rDThetaCos = static_cast<int32_t>((static_cast<int64_t>(rDTheta) * polar.cosA) >> 16);
+            int32_t rDThetaSin = static_cast<int32_t>((static_cast<int64_t>(rDTheta) * sinA) >> 16);
+            int32_t rDThetaCos = static_cast<int32_t>((static_cast<int64_t>(rDTheta) * cosA) >> 16);
 
             return Vec2I32{drCos - rDThetaSin, drSin + rDThetaCos};
         }
 
-        // ---- Transport mode parameters passed to vector callbacks ----
+        // ---- Transport mode parameters passed to vector fields ----
+
+        using TransportMode = TransportPattern::TransportMode;
 
         struct TransportParams {
-            TransportPattern::TransportMode mode;
             uint8_t gridSize;
             int32_t radialSpeedRaw;    // Q16.16 grid-cell displacement per frame
             int32_t angularSpeedRaw;   // Q16.16 angular displacement (turns * S0X16_ONE)
             int32_t timeRaw;           // Q16.16 accumulated time
+            // PolarPulse radial displacement; uniform across the grid each frame.
+            int32_t pulseDrRaw;
             // Shockwave state.
             int32_t shockwaveRadiusRaw;
             // Attractor positions (Q16.16 grid-cell coords).
@@ -141,152 +168,212 @@ namespace PolarShader {
             int32_t attractorY[kAttractorCount];
         };
 
-        // ---- Vector field functions per mode ----
-
-        Vec2I32 transportVector(uint8_t x, uint8_t y, uint8_t gridSize, const void *params) {
-            const auto &p = *static_cast<const TransportParams *>(params);
-            PolarCoord polar = gridToPolar(x, y, gridSize);
+        constexpr bool usesPolarTable(TransportMode mode) {
+            return mode != TransportMode::SquareSpiral && mode != TransportMode::AttractorField;
+        }
 
-            switch (p.mode) {
-                case TransportPattern::TransportMode::SpiralInward: {
-                    return polarToCartesian(polar, -p.radialSpeedRaw, p.angularSpeedRaw);
+        // ---- Vector field per mode ----
+
+        // Instantiated once per mode so the advection loop carries no mode switch.
+        // polar is only read by modes where usesPolarTable() holds.
+        template<TransportMode Mode>
+        Vec2I32 transportVector(uint8_t x, uint8_t y, const PolarCoord &polar, const TransportParams &p) {
+            if constexpr (Mode == TransportMode::SpiralInward) {
+                return polarToCartesian(polar, -p.radialSpeedRaw, p.angularSpeedRaw);
+            } else if constexpr (Mode == TransportMode::SpiralOutward) {
+                return polarToCartesian(polar, p.radialSpeedRaw, p.angularSpeedRaw);
+            } else if constexpr (Mode == TransportMode::RadialSink) {
+                return polarToCartesian(polar, -p.radialSpeedRaw, 0);
+            } else if constexpr (Mode == TransportMode::RadialSource) {
+                return polarToCartesian(polar, p.radialSpeedRaw, 0);
+            } else if constexpr (Mode == TransportMode::RotatingSwirl) {
+                return polarToCartesian(polar, 0, p.angularSpeedRaw);
+            } else if constexpr (Mode == TransportMode::PolarPulse) {
+                return polarToCartesian(polar, p.pulseDrRaw, 0);
+            } else if constexpr (Mode == TransportMode::Shockwave) {
+                // Gaussian-like displacement peak at wavefront radius.
+                int32_t delta = polar.radiusRaw - p.shockwaveRadiusRaw;
+                int32_t widthRaw = raw(kShockwaveWidthCells);
+                if (widthRaw == 0) widthRaw = 1;
+                // Normalise delta to [-1, 1] over width.
+                int32_t xNorm = static_cast<int32_t>(divI64(static_cast<int64_t>(delta) << 16, widthRaw));
+                int32_t strength;
+                if (xNorm < -(1 << 16) || xNorm > (1 << 16)) {
+                    strength = 0;
+                } else {
+                    // (1 - x²)² approximation.
+                    int32_t x2 = static_cast<int32_t>((static_cast<int64_t>(xNorm) * xNorm) >> 16);
+                    int32_t oneMinusX2 = S0X16_ONE - x2;
+                    if (oneMinusX2 < 0) oneMinusX2 = 0;
+                    strength = static_cast<int32_t>((static_cast<int64_t>(oneMinusX2) * oneMinusX2) >> 16);
                 }
-
-                case TransportPattern::TransportMode::SpiralOutward: {
-                    return polarToCartesian(polar, p.radialSpeedRaw, p.angularSpeedRaw);
+                int32_t dr = static_cast<int32_t>((static_cast<int64_t>(strength) * raw(kShockwaveAmplitude)) >> 16);
+                return polarToCartesian(polar, dr, 0);
+            } else if constexpr (Mode == TransportMode::FractalSpiral) {
+                // Iterative: radius increments while angle steps by sin(radius).
+                int32_t totalDr = 0;
+                int32_t totalDTheta = 0;
+                int32_t rCurrent = polar.radiusRaw;
+                for (uint8_t step = 0; step < kFractalSteps; ++step) {
+                    // Angle step depends on current radius.
+                    int32_t rScaled = static_cast<int32_t>(
+                        (static_cast<int64_t>(rCurrent) * raw(kFractalAngleScale)) >> 16
+                    );
+                    u0x16 rPhase(static_cast<uint16_t>(rScaled + p.timeRaw));
+                    int32_t angleDelta = static_cast<int32_t>(
+                        (static_cast<int64_t>(raw(angleSinU0x16(rPhase))) * p.angularSpeedRaw) >> 16
+                    );
+                    totalDTheta += angleDelta;
+                    totalDr += raw(kFractalRadiusStep);
+                    rCurrent += raw(kFractalRadiusStep);
                 }
-
-                case TransportPattern::TransportMode::RadialSink: {
-                    return polarToCartesian(polar, -p.radialSpeedRaw, 0);
+                // Scale radial by speed parameter.
+                totalDr = static_cast<int32_t>((static_cast<int64_t>(totalDr) * p.radialSpeedRaw) >> 16);
+                return polarToCartesian(polar, totalDr, totalDTheta);
+            } else if constexpr (Mode == TransportMode::SquareSpiral) {
+                (void)polar;
+                // Grid-aligned spiral: determine which arm the pixel is on.
+                int32_t halfRaw = (static_cast<int32_t>(p.gridSize - 1u) << kQ16Shift) >> 1;
+                int32_t px = (static_cast<int32_t>(x) << kQ16Shift) + (S0X16_ONE >> 1) - halfRaw;
+                int32_t py = (static_cast<int32_t>(y) << kQ16Shift) + (S0X16_ONE >> 1) - halfRaw;
+                int32_t apx = px < 0 ? -px : px;
+                int32_t apy = py < 0 ? -py : py;
+
+                // Determine quadrant of the spiral arm based on which edge is closer.
+                // Right→Down→Left→Up in clockwise sense.
+                int32_t speed = p.radialSpeedRaw;
+                if (apx >= apy) {
+                    // Horizontal-dominant: right or left edge.
+                    return (px >= 0)
+                        ? Vec2I32{0, speed}    // right edge → move down
+                        : Vec2I32{0, -speed};  // left edge → move up
                 }
-
-                case TransportPattern::TransportMode::RadialSource: {
-                    return polarToCartesian(polar, p.radialSpeedRaw, 0);
+                // Vertical-dominant: top or bottom edge.
+                return (py >= 0)
+                    ? Vec2I32{-speed, 0}   // bottom → move left
+                    : Vec2I32{speed, 0};   // top → move right
+            } else {
+                static_assert(Mode == TransportMode::AttractorField, "unhandled TransportMode");
+                (void)polar;
+                int32_t totalDx = 0;
+                int32_t totalDy = 0;
+                int32_t pxRaw = (static_cast<int32_t>(x) << kQ16Shift) + (S0X16_ONE >> 1);
+                int32_t pyRaw = (static_cast<int32_t>(y) << kQ16Shift) + (S0X16_ONE >> 1);
+
+                for (uint8_t i = 0; i < kAttractorCount; ++i) {
+                    int32_t dx = p.attractorX[i] - pxRaw;
+                    int32_t dy = p.attractorY[i] - pyRaw;
+                    int64_t dist2 = static_cast<int64_t>(dx) * dx + static_cast<int64_t>(dy) * dy;
+                    if (dist2 < kAttractorMinDist2) dist2 = kAttractorMinDist2;
+
+                    // Inverse-square strength: strength = speed / dist².
+                    // To avoid overflow: strength_raw = (speed << 16) / (dist2 >> 16).
+                    int64_t dist2Shifted = dist2 >> 16;
+                    if (dist2Shifted == 0) dist2Shifted = 1;
+                    int32_t strength = static_cast<int32_t>(
+                        divI64(static_cast<int64_t>(p.radialSpeedRaw) << 16, dist2Shifted)
+                    );
+                    // Clamp to prevent instability.
+                    if (strength > (4 << 16)) strength = 4 << 16;
+
+                    // Radial component (toward attractor).
+                    int32_t radX = static_cast<int32_t>((static_cast<int64_t>(dx) * strength) >> 16);
+                    int32_t radY = static_cast<int32_t>((static_cast<int64_t>(dy) * strength) >> 16);
+                    // Tangential component (perpendicular, CCW).
+                    int32_t tanX = static_cast<int32_t>((static_cast<int64_t>(-dy) * strength) >> 16);
+                    int32_t tanY = static_cast<int32_t>((static_cast<int64_t>(dx) * strength) >> 16);
+                    int32_t swirlRaw = raw(kAttractorSwirlRatio);
+                    tanX = static_cast<int32_t>((static_cast<int64_t>(tanX) * swirlRaw) >> 16);
+                    tanY = static_cast<int32_t>((static_cast<int64_t>(tanY) * swirlRaw) >> 16);
+
+                    totalDx += radX + tanX;
+                    totalDy += radY + tanY;
                 }
+                return Vec2I32{totalDx, totalDy};
+            }
+        }
 
-                case TransportPattern::TransportMode::RotatingSwirl: {
-                    return polarToCartesian(polar, 0, p.angularSpeedRaw);
-                }
+        // Stand-in cell for modes that never read the polar table.
+        constexpr PolarCoord kNoPolar{0, 0, 0};
 
-                case TransportPattern::TransportMode::PolarPulse: {
-                    // Radial pulsation: dr = sin(time * angularSpeed) * amplitude.
-                    u0x16 pulsePhase(static_cast<uint16_t>(
-                        (static_cast<int64_t>(p.timeRaw) * p.angularSpeedRaw) >> 16
-                    ));
-                    int32_t pulseSin = raw(angleSinU0x16(pulsePhase));
-                    int32_t dr = static_cast<int32_t>((static_cast<int64_t>(pulseSin) * p.radialSpeedRaw) >> 16);
-                    return polarToCartesian(polar, dr, 0);
-                }
+        // Vector field for grid::advectGrid2DBackward, specialised per mode. The
+        // polar table is walked in lockstep with the destination, so a cell
+        // costs one inlined vector evaluation and one bilinear fetch.
+        template<TransportMode Mode>
+        struct TransportField {
+            const PolarCoord *polar;
+            const TransportParams *params;
 
-                case TransportPattern::TransportMode::Shockwave: {
-                    // Gaussian-like displacement peak at wavefront radius.
-                    int32_t delta = polar.radiusRaw - p.shockwaveRadiusRaw;
-                    int32_t widthRaw = raw(kShockwaveWidthCells);
-                    if (widthRaw == 0) widthRaw = 1;
-                    // Normalise delta to [-1, 1] over width.
-                    int32_t xNorm = static_cast<int32_t>((static_cast<int64_t>(delta) << 16) / widthRaw);
-                    int32_t strength;
-                    if (xNorm < -(1 << 16) || xNorm > (1 << 16)) {
-                        strength = 0;
-                    } else {
-                        // (1 - x²)² approximation.
-                        int32_t x2 = static_cast<int32_t>((static_cast<int64_t>(xNorm) * xNorm) >> 16);
-                        int32_t oneMinusX2 = S0X16_ONE - x2;
-                        if (oneMinusX2 < 0) oneMinusX2 = 0;
-                        strength = static_cast<int32_t>((static_cast<int64_t>(oneMinusX2) * oneMinusX2) >> 16);
-                    }
-                    int32_t dr = static_cast<int32_t>((static_cast<int64_t>(strength) * raw(kShockwaveAmplitude)) >> 16);
-                    return polarToCartesian(polar, dr, 0);
-                }
+            Vec2I32 operator()(uint8_t x, uint8_t y, size_t index) const {
+                return transportVector<Mode>(x, y, usesPolarTable(Mode) ? polar[index] : kNoPolar, *params);
+            }
+        };
 
-                case TransportPattern::TransportMode::FractalSpiral: {
-                    // Iterative: radius increments while angle steps by sin(radius).
-                    int32_t totalDr = 0;
-                    int32_t totalDTheta = 0;
-                    int32_t rCurrent = polar.radiusRaw;
-                    for (uint8_t step = 0; step < kFractalSteps; ++step) {
-                        // Angle step depends on current radius.
-                        int32_t rScaled = static_cast<int32_t>(
-                            (static_cast<int64_t>(rCurrent) * raw(kFractalAngleScale)) >> 16
-                        );
-                        u0x16 rPhase(static_cast<uint16_t>(rScaled + p.timeRaw));
-                        int32_t angleDelta = static_cast<int32_t>(
-                            (static_cast<int64_t>(raw(angleSinU0x16(rPhase))) * p.angularSpeedRaw) >> 16
-                        );
-                        totalDTheta += angleDelta;
-                        totalDr += raw(kFractalRadiusStep);
-                        rCurrent += raw(kFractalRadiusStep);
-                    }
-                    // Scale radial by speed parameter.
-                    totalDr = static_cast<int32_t>((static_cast<int64_t>(totalDr) * p.radialSpeedRaw) >> 16);
-                    return polarToCartesian(polar, totalDr, totalDTheta);
+        // Velocity glow: add brightness proportional to displacement magnitude.
+        template<TransportMode Mode>
+        void addVelocityGlow(uint16_t *cells, const TransportField<Mode> &field, uint8_t gridSize) {
+            size_t idx = 0;
+            for (uint8_t y = 0; y < gridSize; ++y) {
+                for (uint8_t x = 0; x < gridSize; ++x, ++idx) {
+                    Vec2I32 disp = field(x, y, idx);
+                    uint64_t mag2 = static_cast<uint64_t>(
+                        static_cast<int64_t>(disp.x) * disp.x + static_cast<int64_t>(disp.y) * disp.y
+                    );
+                    uint32_t mag = static_cast<uint32_t>(sqrtU64Raw(mag2));
+                    // Scale magnitude to brightness addition (cap at ~1/4 full).
+                    uint16_t glow = static_cast<uint16_t>(std::min<uint32_t>(mag >> 2, kFullIntensity >> 2));
+                    uint32_t sum = static_cast<uint32_t>(cells[idx]) + glow;
+                    cells[idx] = static_cast<uint16_t>(sum > kFullIntensity ? kFullIntensity : sum);
                 }
+            }
+        }
 
-                case TransportPattern::TransportMode::SquareSpiral: {
-                    // Grid-aligned spiral: determine which arm the pixel is on.
-                    int32_t halfRaw = (static_cast<int32_t>(gridSize - 1u) << kQ16Shift) >> 1;
-                    int32_t px = (static_cast<int32_t>(x) << kQ16Shift) + (S0X16_ONE >> 1) - halfRaw;
-                    int32_t py = (static_cast<int32_t>(y) << kQ16Shift) + (S0X16_ONE >> 1) - halfRaw;
-                    int32_t apx = px < 0 ? -px : px;
-                    int32_t apy = py < 0 ? -py : py;
-
-                    // Determine quadrant of the spiral arm based on which edge is closer.
-                    // Right→Down→Left→Up in clockwise sense.
-                    int32_t speed = p.radialSpeedRaw;
-                    Vec2I32 disp;
-                    if (apx >= apy) {
-                        // Horizontal-dominant: right or left edge.
-                        disp = (px >= 0)
-                            ? Vec2I32{0, speed}    // right edge → move down
-                            : Vec2I32{0, -speed};  // left edge → move up
-                    } else {
-                        // Vertical-dominant: top or bottom edge.
-                        disp = (py >= 0)
-                            ? Vec2I32{-speed, 0}   // bottom → move left
-                            : Vec2I32{speed, 0};   // top → move right
-                    }
-                    return disp;
-                }
+        template<TransportMode Mode>
+        void transportStep(
+            uint16_t *cells,
+            uint16_t *scratch,
+            const PolarCoord *polar,
+            const TransportParams &p,
+            u0x16 fadeFactor,
+            bool velocityGlow
+        ) {
+            const TransportField<Mode> field{polar, &p};
+            advectGrid2DBackward(cells, scratch, p.gridSize, field, fadeFactor);
+            if (velocityGlow) addVelocityGlow(scratch, field, p.gridSize);
+        }
 
-                case TransportPattern::TransportMode::AttractorField: {
-                    int32_t totalDx = 0;
-                    int32_t totalDy = 0;
-                    int32_t pxRaw = (static_cast<int32_t>(x) << kQ16Shift) + (S0X16_ONE >> 1);
-                    int32_t pyRaw = (static_cast<int32_t>(y) << kQ16Shift) + (S0X16_ONE >> 1);
-
-                    for (uint8_t i = 0; i < kAttractorCount; ++i) {
-                        int32_t dx = p.attractorX[i] - pxRaw;
-                        int32_t dy = p.attractorY[i] - pyRaw;
-                        int64_t dist2 = static_cast<int64_t>(dx) * dx + static_cast<int64_t>(dy) * dy;
-                        if (dist2 < kAttractorMinDist2) dist2 = kAttractorMinDist2;
-
-                        // Inverse-square strength: strength = speed / dist².
-                        // To avoid overflow: strength_raw = (speed << 16) / (dist2 >> 16).
-                        int64_t dist2Shifted = dist2 >> 16;
-                        if (dist2Shifted == 0) dist2Shifted = 1;
-                        int32_t strength = static_cast<int32_t>(
-                            (static_cast<int64_t>(p.radialSpeedRaw) << 16) / dist2Shifted
-                        );
-                        // Clamp to prevent instability.
-                        if (strength > (4 << 16)) strength = 4 << 16;
-
-                        // Radial component (toward attractor).
-                        int32_t radX = static_cast<int32_t>((static_cast<int64_t>(dx) * strength) >> 16);
-                        int32_t radY = static_cast<int32_t>((static_cast<int64_t>(dy) * strength) >> 16);
-                        // Tangential component (perpendicular, CCW).
-                        int32_t tanX = static_cast<int32_t>((static_cast<int64_t>(-dy) * strength) >> 16);
-                        int32_t tanY = static_cast<int32_t>((static_cast<int64_t>(dx) * strength) >> 16);
-                        int32_t swirlRaw = raw(kAttractorSwirlRatio);
-                        tanX = static_cast<int32_t>((static_cast<int64_t>(tanX) * swirlRaw) >> 16);
-                        tanY = static_cast<int32_t>((static_cast<int64_t>(tanY) * swirlRaw) >> 16);
-
-                        totalDx += radX + tanX;
-                        totalDy += radY + tanY;
-                    }
-                    return Vec2I32{totalDx, totalDy};
-                }
+        // One switch per frame picks the specialised loop.
+        void transportStep(
+            TransportMode mode,
+            uint16_t *cells,
+            uint16_t *scratch,
+            const PolarCoord *polar,
+            const TransportParams &p,
+            u0x16 fadeFactor,
+            bool velocityGlow
+        ) {
+            switch (mode) {
+                case TransportMode::SpiralInward:
+                    return transportStep<TransportMode::SpiralInward>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::SpiralOutward:
+                    return transportStep<TransportMode::SpiralOutward>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::RadialSink:
+                    return transportStep<TransportMode::RadialSink>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::RadialSource:
+                    return transportStep<TransportMode::RadialSource>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::RotatingSwirl:
+                    return transportStep<TransportMode::RotatingSwirl>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::PolarPulse:
+                    return transportStep<TransportMode::PolarPulse>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::Shockwave:
+                    return transportStep<TransportMode::Shockwave>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::FractalSpiral:
+                    return transportStep<TransportMode::FractalSpiral>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::SquareSpiral:
+                    return transportStep<TransportMode::SquareSpiral>(cells, scratch, polar, p, fadeFactor, velocityGlow);
+                case TransportMode::AttractorField:
+                    return transportStep<TransportMode::AttractorField>(cells, scratch, polar, p, fadeFactor, velocityGlow);
             }
-            return Vec2I32{0, 0};
         }
     }
 
@@ -298,6 +385,8 @@ namespace PolarShader {
         bool velocityGlow;
         std::unique_ptr<uint16_t[]> cells;
         std::unique_ptr<uint16_t[]> scratch;
+        // Per-cell geometry, row-major; null for modes that ignore it.
+        std::unique_ptr<PolarCoord[]> polar;
         S0x16Signal radialSpeedSignal;
         S0x16Signal angularSpeedSignal;
         S0x16Signal halfLifeSignal;
@@ -334,6 +423,11 @@ namespace PolarShader {
             std::fill_n(cells.get(), static_cast<size_t>(size) * size, uint16_t(0));
             std::fill_n(scratch.get(), static_cast<size_t>(size) * size, uint16_t(0));
 
+            if (usesPolarTable(mode)) {
+                polar = std::make_unique<PolarCoord[]>(static_cast<size_t>(size) * size);
+                buildPolarTable(polar.get(), size);
+            }
+
             // Attractor initial phases.
             for (uint8_t i = 0; i < kAttractorCount * 2; ++i) {
                 attractorPhases[i] = static_cast<uint16_t>(random32());
@@ -419,13 +513,21 @@ namespace PolarShader {
 
         // 5. Build transport params and advect.
         TransportParams tp{};
-        tp.mode = s.mode;
         tp.gridSize = gridSize;
         tp.radialSpeedRaw = raw(s.radialSpeed);
         tp.angularSpeedRaw = raw(s.angularSpeed);
         tp.timeRaw = raw(s.timeQ16);
         tp.shockwaveRadiusRaw = s.shockwaveRadiusRaw;
 
+        if (s.mode == TransportMode::PolarPulse) {
+            // Radial pulsation: dr = sin(time * angularSpeed) * amplitude.
+            u0x16 pulsePhase(static_cast<uint16_t>(
+                (static_cast<int64_t>(tp.timeRaw) * tp.angularSpeedRaw) >> 16
+            ));
+            int32_t pulseSin = raw(angleSinU0x16(pulsePhase));
+            tp.pulseDrRaw = static_cast<int32_t>((static_cast<int64_t>(pulseSin) * tp.radialSpeedRaw) >> 16);
+        }
+
         // Compute attractor positions for AttractorField mode.
         if (s.mode == TransportMode::AttractorField) {
             fl::s16x16 gc = gridCenter;
@@ -443,31 +545,10 @@ namespace PolarShader {
         }
 
         u0x16 fadeFactor = halfLifeFade(dtMs, s.halfLifeMs);
-        uint16_t *scratch = s.scratch.get();
-
-        advectGrid2DBackward(cells, scratch, gridSize, transportVector, &tp, fadeFactor);
 
-        // Swap cells and scratch.
+        // 6. Advect into scratch, optionally add velocity glow, then swap.
+        transportStep(s.mode, cells, s.scratch.get(), s.polar.get(), tp, fadeFactor, s.velocityGlow);
         s.cells.swap(s.scratch);
-
-        // 6. Velocity glow: add brightness proportional to displacement magnitude.
-        if (s.velocityGlow) {
-            uint16_t *result = s.cells.get();
-            for (uint8_t y = 0; y < gridSize; ++y) {
-                for (uint8_t x = 0; x < gridSize; ++x) {
-                    Vec2I32 disp = transportVector(x, y, gridSize, &tp);
-                    uint64_t mag2 = static_cast<uint64_t>(
-                        static_cast<int64_t>(disp.x) * disp.x + static_cast<int64_t>(disp.y) * disp.y
-                    );
-                    uint32_t mag = static_cast<uint32_t>(sqrtU64Raw(mag2));
-                    // Scale magnitude to brightness addition (cap at ~1/4 full).
-                    uint16_t glow = static_cast<uint16_t>(std::min<uint32_t>(mag >> 2, kFullIntensity >> 2));
-                    size_t idx = static_cast<size_t>(y) * gridSize + x;
-                    uint32_t sum = static_cast<uint32_t>(result[idx]) + glow;
-                    result[idx] = static_cast<uint16_t>(sum > kFullIntensity ? kFullIntensity : sum);
-                }
-            }
-        }
     }
 
     // ---- layer ----
@@ -110,6 +110,7 @@ namespace PolarShader {
                 next[idx] = result;
             }
         }
+        markChangedRows(cells.get(), next.get());
         cells.swap(next);
         // No electrons left means the board is frozen: reseed for a fresh mesh.
         return liveElectrons;
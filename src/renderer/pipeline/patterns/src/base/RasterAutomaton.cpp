@@ -25,6 +25,8 @@
 #endif
 
 #include "renderer/pipeline/patterns/base/RasterAutomaton.h"
+#include <cstring>
+#include <new>
 
 namespace PolarShader {
     namespace raster {
@@ -88,14 +90,153 @@ namespace PolarShader {
             count += cells[rowDown + xRight] == targetState;
             return count;
         }
+
+        namespace {
+            uint32_t lastWordMask(uint16_t width) {
+                const uint16_t used = width & 31u;
+                return used == 0 ? 0xFFFFFFFFu : ((1u << used) - 1u);
+            }
+
+            // Word w of the row with every cell moved one column right, so
+            // bit x holds cell x - 1 (wrapping from the last cell).
+            uint32_t westWord(const uint32_t *row, uint16_t w, uint16_t width) {
+                const uint32_t carry = w == 0
+                    ? (row[(width - 1u) >> 5] >> ((width - 1u) & 31u)) & 1u
+                    : row[w - 1u] >> 31;
+                return (row[w] << 1) | carry;
+            }
+
+            // Word w of the row with every cell moved one column left, so bit
+            // x holds cell x + 1 (wrapping to the first cell).
+            uint32_t eastWord(const uint32_t *row, uint16_t w, uint16_t words, uint16_t width) {
+                uint32_t result = row[w] >> 1;
+                if (w + 1u < words) {
+                    result |= row[w + 1u] << 31;
+                } else {
+                    result |= (row[0] & 1u) << ((width - 1u) & 31u);
+                }
+                return result;
+            }
+
+            void fullAdd(uint32_t a, uint32_t b, uint32_t c, uint32_t &sum, uint32_t &carry) {
+                const uint32_t ab = a ^ b;
+                sum = ab ^ c;
+                carry = (a & b) | (c & ab);
+            }
+
+            void halfAdd(uint32_t a, uint32_t b, uint32_t &sum, uint32_t &carry) {
+                sum = a ^ b;
+                carry = a & b;
+            }
+        }
+
+        uint16_t packedWordsPerRow(uint16_t width) {
+            return static_cast<uint16_t>((width + 31u) >> 5);
+        }
+
+        bool packedCell(const uint32_t *board, uint16_t wordsPerRow, uint16_t x, uint16_t y) {
+            return (board[static_cast<uint32_t>(y) * wordsPerRow + (x >> 5)] >> (x & 31u)) & 1u;
+        }
+
+        void setPackedCell(uint32_t *board, uint16_t wordsPerRow, uint16_t x, uint16_t y, bool alive) {
+            uint32_t &word = board[static_cast<uint32_t>(y) * wordsPerRow + (x >> 5)];
+            const uint32_t bit = 1u << (x & 31u);
+            word = alive ? (word | bit) : (word & ~bit);
+        }
+
+        bool stepLifePacked(
+            const uint32_t *current,
+            uint32_t *next,
+            uint16_t width,
+            uint16_t height,
+            uint16_t birthMask,
+            uint16_t survivalMask,
+            uint16_t firstRow,
+            uint16_t endRow
+        ) {
+            if (!current || !next || width == 0 || height == 0) return false;
+            if (endRow > height) endRow = height;
+
+            const uint16_t words = packedWordsPerRow(width);
+            const uint32_t tailMask = lastWordMask(width);
+            bool changed = false;
+
+            for (uint16_t y = firstRow; y < endRow; ++y) {
+                const uint16_t yUp = y == 0 ? static_cast<uint16_t>(height - 1) : static_cast<uint16_t>(y - 1);
+                const uint16_t yDown = y == height - 1 ? 0 : static_cast<uint16_t>(y + 1);
+                const uint32_t *up = current + static_cast<uint32_t>(yUp) * words;
+                const uint32_t *mid = current + static_cast<uint32_t>(y) * words;
+                const uint32_t *down = current + static_cast<uint32_t>(yDown) * words;
+                uint32_t *out = next + static_cast<uint32_t>(y) * words;
+
+                for (uint16_t w = 0; w < words; ++w) {
+                    // Sum the eight neighbour planes into a 4-bit count per
+                    // cell: ones + 2 * twos + 4 * fours + 8 * eights.
+                    uint32_t s1, c1, s2, c2, s3, c3, ones, c4;
+                    fullAdd(westWord(up, w, width), up[w], eastWord(up, w, words, width), s1, c1);
+                    fullAdd(westWord(mid, w, width), eastWord(mid, w, words, width), westWord(down, w, width), s2, c2);
+                    halfAdd(down[w], eastWord(down, w, words, width), s3, c3);
+                    fullAdd(s1, s2, s3, ones, c4);
+
+                    uint32_t t, c5, twos, c6, fours, eights;
+                    fullAdd(c1, c2, c3, t, c5);
+                    halfAdd(t, c4, twos, c6);
+                    halfAdd(c5, c6, fours, eights);
+
+                    const uint32_t alive = mid[w];
+                    uint32_t result = 0;
+                    for (uint8_t n = 0; n <= 8; ++n) {
+                        const bool born = (birthMask >> n) & 1u;
+                        const bool survives = (survivalMask >> n) & 1u;
+                        if (!born && !survives) continue;
+
+                        const uint32_t match =
+                            ((n & 1u) ? ones : ~ones) &
+                            ((n & 2u) ? twos : ~twos) &
+                            ((n & 4u) ? fours : ~fours) &
+                            ((n & 8u) ? eights : ~eights);
+                        result |= match & ((born ? ~alive : 0u) | (survives ? alive : 0u));
+                    }
+                    if (w + 1u == words) result &= tailMask;
+
+                    out[w] = result;
+                    changed = changed || result != alive;
+                }
+            }
+            return changed;
+        }
+
+        void stepElementaryPacked(const uint32_t *row, uint32_t *out, uint16_t width, uint8_t rule) {
+            if (!row || !out || width == 0) return;
+
+            const uint16_t words = packedWordsPerRow(width);
+            for (uint16_t w = 0; w < words; ++w) {
+                const uint32_t left = westWord(row, w, width);
+                const uint32_t centre = row[w];
+                const uint32_t right = eastWord(row, w, words, width);
+
+                uint32_t result = 0;
+                for (uint8_t triple = 0; triple < 8; ++triple) {
+                    if (!((rule >> triple) & 1u)) continue;
+                    result |=
+                        ((triple & 4u) ? left : ~left) &
+                        ((triple & 2u) ? centre : ~centre) &
+                        ((triple & 1u) ? right : ~right);
+                }
+                out[w] = w + 1u == words ? (result & lastWordMask(width)) : result;
+            }
+        }
     }
 
     namespace {
         constexpr uint8_t kMaxCatchUpStepsPerFrame = 4;
+        // Time-sliced patterns carry up to this many steps of backlog but
+        // work off at most one step's rows in a frame.
+        constexpr uint8_t kMaxSlicedBacklogSteps = 4;
     }
 
-    RasterAutomaton::RasterAutomaton(uint16_t stepIntervalMs, uint16_t seed)
-        : stepIntervalMs(stepIntervalMs), seedParam(seed) {
+    RasterAutomaton::RasterAutomaton(uint16_t stepIntervalMs, uint16_t seed, bool timeSliced)
+        : stepIntervalMs(stepIntervalMs), seedParam(seed), timeSliced(timeSliced) {
     }
 
     void RasterAutomaton::seedInitial() const {
@@ -104,7 +245,11 @@ namespace PolarShader {
         hasLastElapsed = false;
         lastElapsedMs = 0;
         accumulatedMs = 0;
+        sliceCredit = 0;
+        sliceRow = 0;
         seed(raster::seedForGeneration(baseSeed, generation));
+        ++changes.generation;
+        markAllRowsChanged();
     }
 
     void RasterAutomaton::reseed() const {
@@ -116,6 +261,111 @@ namespace PolarShader {
         }
         seed(raster::seedForGeneration(baseSeed, generation));
         accumulatedMs = 0;
+        sliceCredit = 0;
+        sliceRow = 0;
+        ++changes.generation;
+        markAllRowsChanged();
+    }
+
+    void RasterAutomaton::advanceGeneration() const {
+        ++changes.generation;
+        rowsMarked = false;
+        if (!step()) {
+            reseed();
+            return;
+        }
+        if (!rowsMarked) markAllRowsChanged();
+    }
+
+    bool RasterAutomaton::publishStage(uint16_t stage) const {
+        ++changes.generation;
+        rowsMarked = false;
+        if (!finishStage(stage)) {
+            reseed();
+            return false;
+        }
+        if (!rowsMarked) markAllRowsChanged();
+        return true;
+    }
+
+    void RasterAutomaton::advanceSliced(TimeMillis deltaMs) const {
+        const uint32_t rows = static_cast<uint32_t>(stepStages()) * grid.height;
+        const uint64_t maxCredit = static_cast<uint64_t>(stepIntervalMs) * rows * kMaxSlicedBacklogSteps;
+        sliceCredit += static_cast<uint64_t>(deltaMs) * rows;
+        if (sliceCredit > maxCredit) sliceCredit = maxCredit;
+
+        uint64_t due = sliceCredit / stepIntervalMs;
+        if (due > rows) due = rows;
+        sliceCredit -= due * stepIntervalMs;
+        advanceRows(static_cast<uint32_t>(due));
+    }
+
+    void RasterAutomaton::advanceRows(uint32_t count) const {
+        const uint16_t stages = stepStages();
+        while (count > 0) {
+            const uint16_t stage = static_cast<uint16_t>(sliceRow / grid.height);
+            const uint16_t row = static_cast<uint16_t>(sliceRow % grid.height);
+            const uint32_t left = static_cast<uint32_t>(grid.height) - row;
+            const uint16_t n = static_cast<uint16_t>(count < left ? count : left);
+            stepRows(stage, row, static_cast<uint16_t>(row + n));
+            sliceRow += n;
+            count -= n;
+            if (row + n < grid.height) continue;
+
+            if (stage + 1u >= stages) sliceRow = 0;
+            // A reseed restarts the step; leave the rest of the budget unspent.
+            if (!publishStage(stage)) return;
+        }
+    }
+
+    void RasterAutomaton::markAllRowsChanged() const {
+        if (!changes.rows) return;
+        for (uint16_t y = 0; y < changes.height; ++y) {
+            changes.rows[y] = changes.generation;
+        }
+    }
+
+    void RasterAutomaton::markRowChanged(uint16_t y) const {
+        rowsMarked = true;
+        if (changes.rows && y < changes.height) changes.rows[y] = changes.generation;
+    }
+
+    bool RasterAutomaton::markChangedRows(const uint32_t *before, const uint32_t *after) const {
+        rowsMarked = true;
+        if (!before || !after) {
+            markAllRowsChanged();
+            return true;
+        }
+        const uint16_t words = raster::packedWordsPerRow(grid.width);
+        bool changed = false;
+        for (uint16_t y = 0; y < grid.height; ++y) {
+            const uint32_t offset = static_cast<uint32_t>(y) * words;
+            for (uint16_t w = 0; w < words; ++w) {
+                if (before[offset + w] != after[offset + w]) {
+                    markRowChanged(y);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        return changed;
+    }
+
+    bool RasterAutomaton::markChangedRows(const uint8_t *before, const uint8_t *after) const {
+        rowsMarked = true;
+        if (!before || !after) {
+            markAllRowsChanged();
+            return true;
+        }
+        bool changed = false;
+        for (uint16_t y = 0; y < grid.height; ++y) {
+            const uint32_t offset = static_cast<uint32_t>(y) * grid.width;
+            if (std::memcmp(before + offset, after + offset, grid.width) != 0) {
+                markRowChanged(y);
+                changed = true;
+            }
+        }
+        return changed;
     }
 
     void RasterAutomaton::configure(const std::shared_ptr<PipelineContext> &context) const {
@@ -152,7 +402,8 @@ namespace PolarShader {
             return;
         }
 
-        if (!allocate(display.width, display.height, display.cellCount)) {
+        std::unique_ptr<uint32_t[]> rows(new (std::nothrow) uint32_t[display.height]);
+        if (!rows || !allocate(display.width, display.height, display.cellCount)) {
             if (!grid.warnedAllocation) {
                 Serial.println("RasterAutomaton failed to allocate raster buffers; rendering black.");
                 grid.warnedAllocation = true;
@@ -169,6 +420,9 @@ namespace PolarShader {
         grid.height = display.height;
         grid.cellCount = display.cellCount;
         grid.ready = true;
+        changes.rows = std::move(rows);
+        changes.width = display.width;
+        changes.height = display.height;
         grid.warnedNoRaster = false;
         grid.warnedCapacity = false;
         grid.warnedAllocation = false;
@@ -185,6 +439,7 @@ namespace PolarShader {
             hasLastElapsed = true;
             lastElapsedMs = elapsedMs;
             accumulatedMs = 0;
+            sliceCredit = 0;
             return;
         }
 
@@ -192,7 +447,16 @@ namespace PolarShader {
         lastElapsedMs = elapsedMs;
 
         if (stepIntervalMs == 0) {
-            if (!step()) reseed();
+            if (timeSliced) {
+                advanceRows(static_cast<uint32_t>(stepStages()) * grid.height - sliceRow);
+            } else {
+                advanceGeneration();
+            }
+            return;
+        }
+
+        if (timeSliced) {
+            advanceSliced(deltaMs);
             return;
         }
 
@@ -205,7 +469,7 @@ namespace PolarShader {
 
         while (accumulatedMs >= stepIntervalMs) {
             accumulatedMs -= stepIntervalMs;
-            if (!step()) reseed();
+            advanceGeneration();
         }
     }
 }
@@ -26,6 +26,10 @@ namespace PolarShader {
         this->context = std::move(context);
     }
 
+    u0x16 UVPattern::renderQuality() const {
+        return context ? context->quality : u0x16(U0X16_MAX);
+    }
+
     UVPattern::UVPattern()
         : layerValue([](UV) { return PatternNormU0x16(0); }) {
     }
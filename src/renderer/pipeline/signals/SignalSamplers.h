@@ -32,6 +32,13 @@ namespace PolarShader {
     SampleSignal sampleTriangle();
     SampleSignal sampleSquare();
     SampleSignal sampleSawtooth();
+
+    // Plain evaluators behind the samplers above, for callers that dispatch on the shape themselves.
+    s0x16 noise32At(uint32_t phase);
+    s0x16 sineAt(u0x16 phase);
+    s0x16 triangleAt(u0x16 phase);
+    s0x16 squareAt(u0x16 phase);
+    s0x16 sawtoothAt(u0x16 phase);
 }
 
 #endif // POLAR_SHADER_PIPELINE_SIGNAL_SAMPLERS_H
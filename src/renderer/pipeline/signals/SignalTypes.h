@@ -28,6 +28,7 @@
 #endif
 #include "renderer/pipeline/maths/units/Units.h"
 #include "renderer/pipeline/maths/ScalarMaths.h"
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -44,6 +45,128 @@ namespace PolarShader {
         SATURATE
     };
 
+    /**
+     * @brief How a signal's value at a given time is obtained.
+     *
+     * CONSTANT and CLOSED_FORM signals are pure functions of elapsedMs and can be sampled at any
+     * time, in any order. INTEGRATED signals carry state between samples and must be stepped
+     * forward frame by frame.
+     */
+    enum class SignalEvaluation : uint8_t {
+        CONSTANT,
+        CLOSED_FORM,
+        INTEGRATED
+    };
+
+    /** @brief The evaluation mode of a signal derived from two inputs: the least seekable wins. */
+    constexpr SignalEvaluation combineEvaluation(SignalEvaluation a, SignalEvaluation b) {
+        return static_cast<uint8_t>(a) > static_cast<uint8_t>(b) ? a : b;
+    }
+
+    class S0x16Signal;
+
+    enum class SignalOp : uint8_t {
+        CONSTANT,
+        LINEAR,
+        QUADRATIC_IN,
+        QUADRATIC_OUT,
+        QUADRATIC_IN_OUT,
+        PERIODIC,            // constant speed, phase in closed form
+        PERIODIC_INTEGRATED, // speed from child 0, phase integrated per sample
+        NOISE,
+        LOOPING_NOISE,
+        SMAP,
+        SCALE,
+        WAVEFORM             // custom WaveformFn leaf
+    };
+
+    enum class PeriodicShape : uint8_t {
+        SINE,
+        TRIANGLE,
+        SQUARE,
+        SAWTOOTH
+    };
+
+    /**
+     * @brief One node of a SignalProgram.
+     *
+     * Nodes are stored parents first, so every child index is greater than its parent's; index 0
+     * is the root and doubles as "no child".
+     */
+    struct SignalNode {
+        TimeMillis durationMs{0};
+        // Integrated periodic: previous sample time.
+        TimeMillis lastMs{0};
+        // Per-evaluation scratch: the time this node sees after its parents' aperiodic windows.
+        TimeMillis timeMs{0};
+        // Op parameters: constant value, phase offset, speed, scale factor, loop period or waveform index.
+        int32_t a{0};
+        int32_t b{0};
+        // Op state carried across samples: integrated phase or looping-noise span.
+        uint32_t phaseRaw32{0};
+        // Per-evaluation scratch: pending integration step and saturated output.
+        int32_t deltaMs{0};
+        int32_t value{0};
+        uint16_t child[3]{0, 0, 0};
+        SignalOp op{SignalOp::CONSTANT};
+        SignalKind kind{SignalKind::PERIODIC};
+        LoopMode loopMode{LoopMode::RESET};
+        PeriodicShape shape{PeriodicShape::SINE};
+        uint8_t flags{0};
+    };
+
+    /**
+     * @brief A signal tree flattened into one contiguous node array.
+     *
+     * evaluate() walks the array twice: parents first to hand each node its time and decide which
+     * children are sampled, then children first to compute values. Outputs are identical to sampling
+     * the equivalent tree of nested signals.
+     */
+    class SignalProgram {
+    public:
+        using WaveformFn = fl::function<s0x16(TimeMillis)>;
+
+        SignalProgram() = default;
+        SignalProgram(const SignalProgram &other);
+        SignalProgram(SignalProgram &&other) noexcept = default;
+        SignalProgram &operator=(const SignalProgram &other);
+        SignalProgram &operator=(SignalProgram &&other) noexcept = default;
+        ~SignalProgram();
+
+        static SignalProgram leaf(const SignalNode &node);
+
+        static SignalProgram waveform(SignalKind kind, LoopMode loopMode, TimeMillis durationMs, WaveformFn waveform);
+
+        /** @brief Builds `root` over the given signals, splicing each one's nodes in as child i. */
+        static SignalProgram compose(const SignalNode &root, S0x16Signal *children, uint8_t childCount);
+
+        /**
+         * @brief Evaluates `root` once over constant children, without allocating.
+         * @note Only meaningful when the result cannot change with time, e.g. smap() of constants.
+         */
+        static s0x16 fold(const SignalNode &root, const S0x16Signal *children, uint8_t childCount);
+
+        /** @brief Samples the root at elapsedMs, saturated to [-1, 1] but not range-mapped. */
+        s0x16 evaluate(TimeMillis elapsedMs);
+
+        const SignalNode &root() const { return nodes_[0]; }
+
+        uint16_t size() const { return nodeCount_; }
+
+        explicit operator bool() const { return nodeCount_ != 0; }
+
+    private:
+        void classify();
+
+        std::unique_ptr<SignalNode[]> nodes_;
+        std::unique_ptr<WaveformFn[]> waveforms_;
+        uint16_t nodeCount_{0};
+        uint16_t waveformCount_{0};
+        // Every node sees the root's time and samples all of its children, so evaluate() can
+        // skip the parents-first pass.
+        bool uniformTime_{true};
+    };
+
     /**
      * @brief Time-indexed scalar signal saturated to signed s0x16 (Q0.16) [-1, 1].
      */
@@ -55,8 +178,10 @@ namespace PolarShader {
 
         S0x16Signal(
             SignalKind kind,
-            WaveformFn waveform
+            WaveformFn waveform,
+            SignalEvaluation evaluation = SignalEvaluation::INTEGRATED
         ) : kind_(kind),
+            evaluation_(evaluation),
             waveformFn(std::move(waveform)) {
         }
 
@@ -64,13 +189,34 @@ namespace PolarShader {
             SignalKind kind,
             LoopMode loopMode,
             TimeMillis durationMs,
-            WaveformFn waveform
+            WaveformFn waveform,
+            SignalEvaluation evaluation = SignalEvaluation::INTEGRATED
         ) : kind_(kind),
             loopMode_(loopMode),
+            evaluation_(evaluation),
             durationMs_(durationMs),
             waveformFn(std::move(waveform)) {
         }
 
+        S0x16Signal(
+            SignalProgram program,
+            SignalEvaluation evaluation
+        ) : kind_(program ? program.root().kind : SignalKind::PERIODIC),
+            loopMode_(program ? program.root().loopMode : LoopMode::RESET),
+            evaluation_(evaluation),
+            durationMs_(program ? program.root().durationMs : 0),
+            program_(std::move(program)) {
+        }
+
+        /** @brief A fixed value held inline: no program, no waveform, no allocation. */
+        static S0x16Signal fixed(s0x16 value) {
+            S0x16Signal signal;
+            signal.evaluation_ = SignalEvaluation::CONSTANT;
+            signal.constant_ = true;
+            signal.constantRaw_ = raw(clampS0x16Sat(raw(value)));
+            return signal;
+        }
+
         static S0x16Signal periodic(WaveformFn waveform) {
             return {SignalKind::PERIODIC, std::move(waveform)};
         }
@@ -81,6 +227,8 @@ namespace PolarShader {
 
         template<typename RangeT>
         auto sample(const RangeT &range, TimeMillis elapsedMs) const {
+            if (constant_) return range.map(s0x16(constantRaw_));
+            if (program_) return range.map(program_.evaluate(elapsedMs));
             if (!waveformFn) return range.map(s0x16(0));
 
             TimeMillis relativeTime = elapsedMs;
@@ -116,15 +264,47 @@ namespace PolarShader {
             return durationMs_;
         }
 
+        /** @brief Custom waveforms are assumed INTEGRATED; an empty signal is CONSTANT (it samples 0). */
+        SignalEvaluation evaluation() const {
+            return *this ? evaluation_ : SignalEvaluation::CONSTANT;
+        }
+
+        /** @brief True when sample() may jump to any elapsedMs without replaying earlier frames. */
+        bool isSeekable() const {
+            return evaluation() != SignalEvaluation::INTEGRATED;
+        }
+
         explicit operator bool() const {
-            return static_cast<bool>(waveformFn);
+            return constant_ || static_cast<bool>(program_) || static_cast<bool>(waveformFn);
+        }
+
+        /** @brief True for fixed values, including constant-only trees folded at build time. */
+        bool isConstant() const {
+            return constant_;
         }
 
+        /** @brief The saturated value of a constant signal, before range mapping; 0 otherwise. */
+        s0x16 constantValue() const {
+            return s0x16(constantRaw_);
+        }
+
+        /** @brief The flat node array behind signals built by the Signals.h factories; empty for custom waveforms. */
+        const SignalProgram &program() const {
+            return program_;
+        }
+
+        /** @brief Moves this signal out as a program, wrapping a custom waveform in a single WAVEFORM node. */
+        SignalProgram takeProgram() &&;
+
     private:
         SignalKind kind_{SignalKind::PERIODIC};
         LoopMode loopMode_{LoopMode::RESET};
+        SignalEvaluation evaluation_{SignalEvaluation::INTEGRATED};
         TimeMillis durationMs_{0};
         WaveformFn waveformFn;
+        mutable SignalProgram program_;
+        bool constant_{false};
+        int32_t constantRaw_{0};
     };
 
     class UVSignal {
@@ -45,6 +45,14 @@ namespace PolarShader {
         // phaseSpeed returns turns-per-second
         SpeedSampleFn phaseSpeed;
     };
+
+    /**
+     * @brief Closed-form counterpart of PhaseAccumulator::advanceRaw() for a constant speed.
+     *
+     * Returns the 32-bit phase reached at elapsedMs when integrating from elapsedMs = 0, without
+     * the per-frame delta clamp, so the result does not depend on which frames were sampled.
+     */
+    uint32_t phaseAtConstantSpeedRaw(u0x16 initialPhase, s0x16 speed, TimeMillis elapsedMs);
 }
 
 #endif // POLAR_SHADER_PIPELINE_SIGNALS_ACCUMULATORS_H
@@ -0,0 +1,401 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderer/pipeline/signals/SignalTypes.h"
+#include "renderer/pipeline/signals/SignalSamplers.h"
+#include "renderer/pipeline/signals/accumulators/Accumulators.h"
+#include "renderer/pipeline/maths/ScalarMaths.h"
+#include <cstdint>
+#include <utility>
+
+namespace PolarShader {
+    namespace {
+        constexpr uint8_t kActive = 1u << 0; // sampled this evaluation
+        constexpr uint8_t kLive = 1u << 1;   // active and inside a non-empty aperiodic window
+        constexpr uint8_t kPrimed = 1u << 2; // integrated phase has a previous sample / span is known
+
+        u0x16 timeToProgress(TimeMillis t, TimeMillis duration) {
+            if (duration == 0) return u0x16(0);
+            if (t >= duration) t = duration;
+            uint64_t scaled = (static_cast<uint64_t>(t) * UINT16_MAX) / duration;
+            if (scaled > UINT16_MAX) scaled = UINT16_MAX;
+            return u0x16(static_cast<uint16_t>(scaled));
+        }
+
+        s0x16 easeAt(SignalOp op, TimeMillis t, TimeMillis duration) {
+            const uint32_t p = raw(timeToProgress(t, duration));
+            switch (op) {
+                case SignalOp::QUADRATIC_IN: {
+                    uint32_t result = (static_cast<uint64_t>(p) * p + (1u << 15)) >> 16;
+                    return toSigned(u0x16(result));
+                }
+                case SignalOp::QUADRATIC_OUT: {
+                    uint32_t inv = 0xFFFFu - p;
+                    uint32_t result = 0xFFFFu - ((static_cast<uint64_t>(inv) * inv + (1u << 15)) >> 16);
+                    return toSigned(u0x16(result));
+                }
+                case SignalOp::QUADRATIC_IN_OUT: {
+                    if (p < 0x8000u) {
+                        uint32_t result = (static_cast<uint64_t>(p) * p + (1u << 14)) >> 15;
+                        return toSigned(u0x16(result));
+                    }
+                    uint32_t inv = 0xFFFFu - p;
+                    uint32_t tail = (static_cast<uint64_t>(inv) * inv + (1u << 14)) >> 15;
+                    return toSigned(u0x16(0xFFFFu - tail));
+                }
+                default:
+                    return toSigned(u0x16(p));
+            }
+        }
+
+        s0x16 shapeAt(PeriodicShape shape, uint32_t phaseRaw32) {
+            const u0x16 phase(static_cast<uint16_t>(phaseRaw32 >> 16));
+            switch (shape) {
+                case PeriodicShape::TRIANGLE: return triangleAt(phase);
+                case PeriodicShape::SQUARE:   return squareAt(phase);
+                case PeriodicShape::SAWTOOTH: return sawtoothAt(phase);
+                default:                      return sineAt(phase);
+            }
+        }
+
+        // magnitudeRange().map() without the virtual call. Node values are already saturated, so
+        // bipolarRange().map() leaves them unchanged and is skipped outright.
+        uint32_t magnitudeRaw(const SignalNode &node) {
+            const int64_t unsignedRaw = raw(toUnsignedClamped(s0x16(node.value)));
+            return static_cast<uint32_t>((static_cast<int64_t>(S0X16_MAX) * unsignedRaw + (1LL << 15)) >> 16);
+        }
+
+        // Computes one node from its children's values; shared by both evaluation paths.
+        int32_t nodeValue(
+            SignalNode &node,
+            const SignalNode *nodes,
+            const SignalProgram::WaveformFn *waveforms,
+            TimeMillis t
+        ) {
+            int64_t value = 0;
+            switch (node.op) {
+                case SignalOp::CONSTANT:
+                    value = node.a;
+                    break;
+
+                case SignalOp::LINEAR:
+                case SignalOp::QUADRATIC_IN:
+                case SignalOp::QUADRATIC_OUT:
+                case SignalOp::QUADRATIC_IN_OUT:
+                    value = raw(easeAt(node.op, t, node.durationMs));
+                    break;
+
+                case SignalOp::PERIODIC: {
+                    const uint32_t phaseRaw32 = phaseAtConstantSpeedRaw(
+                        u0x16(static_cast<uint16_t>(node.a)), s0x16(node.b), t);
+                    value = raw(shapeAt(node.shape, phaseRaw32));
+                    break;
+                }
+
+                case SignalOp::PERIODIC_INTEGRATED:
+                    if (node.deltaMs != 0) {
+                        const int64_t speedRaw = magnitudeRaw(nodes[node.child[0]]);
+                        const int64_t increment = (speedRaw * node.deltaMs * 65536LL + 500LL) / 1000LL;
+                        node.phaseRaw32 = static_cast<uint32_t>(static_cast<int64_t>(node.phaseRaw32) + increment);
+                    }
+                    value = raw(shapeAt(node.shape, node.phaseRaw32));
+                    break;
+
+                case SignalOp::NOISE: {
+                    // At phaseVelocity 1.0 (65536), the coordinate advances by 1 per millisecond.
+                    const uint64_t coord64 = (static_cast<uint64_t>(t) * magnitudeRaw(nodes[node.child[0]])) >> 16;
+                    value = raw(noise32At(static_cast<uint32_t>(coord64) + static_cast<uint32_t>(node.a)));
+                    break;
+                }
+
+                case SignalOp::LOOPING_NOISE: {
+                    const TimeMillis loopPeriodMs = static_cast<TimeMillis>(static_cast<uint32_t>(node.b));
+                    if (!(node.flags & kPrimed)) {
+                        node.phaseRaw32 = static_cast<uint32_t>(
+                            (static_cast<uint64_t>(loopPeriodMs) * magnitudeRaw(nodes[node.child[0]])) >> 16);
+                        node.flags |= kPrimed;
+                    }
+                    const uint32_t span = node.phaseRaw32;
+                    const uint16_t phiRaw = static_cast<uint16_t>(
+                        static_cast<uint64_t>(t % loopPeriodMs) * 65535u / loopPeriodMs);
+                    const uint32_t coordA = static_cast<uint32_t>(node.a) +
+                        static_cast<uint32_t>((static_cast<uint64_t>(phiRaw) * span) >> 16);
+                    const uint32_t coordB = coordA - span;
+
+                    int32_t w = 32767 - static_cast<int32_t>(cos16(static_cast<uint16_t>(phiRaw >> 1)));
+                    if (w < 0) w = 0;
+                    if (w > 65535) w = 65535;
+
+                    const int32_t a = raw(noise32At(coordA));
+                    const int32_t b = raw(noise32At(coordB));
+                    value = a + static_cast<int32_t>((static_cast<int64_t>(b - a) * w) >> 16);
+                    break;
+                }
+
+                case SignalOp::SMAP: {
+                    uint32_t floorRaw = magnitudeRaw(nodes[node.child[1]]);
+                    uint32_t ceilingRaw = magnitudeRaw(nodes[node.child[2]]);
+                    if (floorRaw > ceilingRaw) {
+                        std::swap(floorRaw, ceilingRaw);
+                    }
+                    const uint32_t sourceRaw = raw(toUnsignedClamped(s0x16(nodes[node.child[0]].value)));
+                    const uint32_t span = ceilingRaw - floorRaw;
+                    const uint32_t mappedRaw = floorRaw + ((span * sourceRaw + (1u << 15)) >> 16);
+                    value = raw(toSigned(u0x16(static_cast<uint16_t>(mappedRaw))));
+                    break;
+                }
+
+                case SignalOp::SCALE:
+                    value = raw(mulS0x16Sat(s0x16(nodes[node.child[0]].value), s0x16(node.a)));
+                    break;
+
+                case SignalOp::WAVEFORM: {
+                    const SignalProgram::WaveformFn &waveform = waveforms[node.a];
+                    value = waveform ? raw(waveform(t)) : 0;
+                    break;
+                }
+            }
+            return raw(clampS0x16Sat(value));
+        }
+
+        TimeMillis windowTime(const SignalNode &node, TimeMillis t) {
+            if (node.loopMode == LoopMode::SATURATE) return (t >= node.durationMs) ? node.durationMs : t;
+            return t % node.durationMs;
+        }
+
+        void activate(SignalNode *nodes, uint16_t index, TimeMillis timeMs) {
+            nodes[index].flags |= kActive;
+            nodes[index].timeMs = timeMs;
+        }
+    }
+
+    SignalProgram::SignalProgram(const SignalProgram &other) {
+        *this = other;
+    }
+
+    SignalProgram &SignalProgram::operator=(const SignalProgram &other) {
+        if (this == &other) return *this;
+        nodes_.reset(other.nodeCount_ ? new SignalNode[other.nodeCount_] : nullptr);
+        waveforms_.reset(other.waveformCount_ ? new WaveformFn[other.waveformCount_] : nullptr);
+        nodeCount_ = other.nodeCount_;
+        waveformCount_ = other.waveformCount_;
+        uniformTime_ = other.uniformTime_;
+        for (uint16_t i = 0; i < nodeCount_; ++i) nodes_[i] = other.nodes_[i];
+        for (uint16_t i = 0; i < waveformCount_; ++i) waveforms_[i] = other.waveforms_[i];
+        return *this;
+    }
+
+    SignalProgram::~SignalProgram() = default;
+
+    SignalProgram SignalProgram::leaf(const SignalNode &node) {
+        SignalProgram program;
+        program.nodes_.reset(new SignalNode[1]);
+        program.nodes_[0] = node;
+        program.nodeCount_ = 1;
+        program.classify();
+        return program;
+    }
+
+    SignalProgram SignalProgram::waveform(
+        SignalKind kind,
+        LoopMode loopMode,
+        TimeMillis durationMs,
+        WaveformFn waveform
+    ) {
+        SignalNode node;
+        node.op = SignalOp::WAVEFORM;
+        node.kind = kind;
+        node.loopMode = loopMode;
+        node.durationMs = durationMs;
+        SignalProgram program = leaf(node);
+        program.waveforms_.reset(new WaveformFn[1]);
+        program.waveforms_[0] = std::move(waveform);
+        program.waveformCount_ = 1;
+        return program;
+    }
+
+    SignalProgram SignalProgram::compose(const SignalNode &root, S0x16Signal *children, uint8_t childCount) {
+        SignalProgram parts[3];
+        uint32_t nodeCount = 1;
+        uint32_t waveformCount = 0;
+        for (uint8_t i = 0; i < childCount && i < 3; ++i) {
+            parts[i] = std::move(children[i]).takeProgram();
+            nodeCount += parts[i].nodeCount_;
+            waveformCount += parts[i].waveformCount_;
+        }
+        if (nodeCount > UINT16_MAX) return SignalProgram();
+
+        SignalProgram program;
+        program.nodes_.reset(new SignalNode[nodeCount]);
+        program.waveforms_.reset(waveformCount ? new WaveformFn[waveformCount] : nullptr);
+        program.nodeCount_ = static_cast<uint16_t>(nodeCount);
+        program.waveformCount_ = static_cast<uint16_t>(waveformCount);
+        program.nodes_[0] = root;
+
+        uint16_t nextNode = 1;
+        uint16_t nextWaveform = 0;
+        for (uint8_t i = 0; i < childCount && i < 3; ++i) {
+            SignalProgram &part = parts[i];
+            program.nodes_[0].child[i] = nextNode;
+            for (uint16_t n = 0; n < part.nodeCount_; ++n) {
+                SignalNode node = part.nodes_[n];
+                for (uint16_t &c : node.child) {
+                    if (c != 0) c = static_cast<uint16_t>(c + nextNode);
+                }
+                if (node.op == SignalOp::WAVEFORM) node.a += nextWaveform;
+                program.nodes_[nextNode + n] = node;
+            }
+            for (uint16_t w = 0; w < part.waveformCount_; ++w) {
+                program.waveforms_[nextWaveform + w] = std::move(part.waveforms_[w]);
+            }
+            nextNode = static_cast<uint16_t>(nextNode + part.nodeCount_);
+            nextWaveform = static_cast<uint16_t>(nextWaveform + part.waveformCount_);
+        }
+        program.classify();
+        return program;
+    }
+
+    s0x16 SignalProgram::fold(const SignalNode &root, const S0x16Signal *children, uint8_t childCount) {
+        SignalNode nodes[4];
+        nodes[0] = root;
+        for (uint8_t i = 0; i < childCount && i < 3; ++i) {
+            nodes[0].child[i] = static_cast<uint16_t>(i + 1);
+            nodes[i + 1].value = raw(children[i].constantValue());
+        }
+        return s0x16(nodeValue(nodes[0], nodes, nullptr, 0));
+    }
+
+    void SignalProgram::classify() {
+        // Windows matching the root's are idempotent on an already windowed time, so only other
+        // aperiodic windows and the ops that skip child samples need the full two-pass walk.
+        const SignalNode &root = nodes_[0];
+        uniformTime_ = true;
+        for (uint16_t i = 0; i < nodeCount_; ++i) {
+            const SignalNode &node = nodes_[i];
+            if (node.op == SignalOp::PERIODIC_INTEGRATED || node.op == SignalOp::LOOPING_NOISE) {
+                uniformTime_ = false;
+            }
+            if (i != 0 && node.kind == SignalKind::APERIODIC &&
+                !(root.kind == SignalKind::APERIODIC &&
+                  node.durationMs == root.durationMs &&
+                  node.loopMode == root.loopMode)) {
+                uniformTime_ = false;
+            }
+        }
+    }
+
+    s0x16 SignalProgram::evaluate(TimeMillis elapsedMs) {
+        SignalNode *nodes = nodes_.get();
+        if (!nodes) return s0x16(0);
+        const WaveformFn *waveforms = waveforms_.get();
+
+        if (uniformTime_) {
+            // Every node sees the root's windowed time and samples all of its children.
+            const SignalNode &root = nodes[0];
+            TimeMillis t = elapsedMs;
+            if (root.kind == SignalKind::APERIODIC) {
+                if (root.durationMs == 0) return s0x16(0);
+                t = windowTime(root, t);
+            }
+            for (uint16_t i = nodeCount_; i-- > 0;) {
+                nodes[i].value = nodeValue(nodes[i], nodes, waveforms, t);
+            }
+            return s0x16(nodes[0].value);
+        }
+
+        // Parents first: map each active node's time through its aperiodic window and decide which
+        // children it samples, the way the nested sample() calls would.
+        nodes[0].flags |= kActive;
+        nodes[0].timeMs = elapsedMs;
+        for (uint16_t i = 0; i < nodeCount_; ++i) {
+            SignalNode &node = nodes[i];
+            for (uint16_t c : node.child) {
+                if (c != 0) nodes[c].flags &= static_cast<uint8_t>(~kActive);
+            }
+            node.flags &= static_cast<uint8_t>(~kLive);
+            if (!(node.flags & kActive)) continue;
+
+            TimeMillis t = node.timeMs;
+            if (node.kind == SignalKind::APERIODIC) {
+                if (node.durationMs == 0) continue;
+                t = windowTime(node, t);
+            }
+            node.timeMs = t;
+            node.flags |= kLive;
+
+            switch (node.op) {
+                case SignalOp::PERIODIC_INTEGRATED: {
+                    // Mirrors PhaseAccumulator::advanceRaw(): the first sample only records the
+                    // time, and the speed is read only when the clamped step is non-zero.
+                    if (!(node.flags & kPrimed)) {
+                        node.flags |= kPrimed;
+                        node.lastMs = t;
+                        node.deltaMs = 0;
+                        break;
+                    }
+                    int64_t deltaMs = static_cast<int64_t>(t) - static_cast<int64_t>(node.lastMs);
+                    node.lastMs = t;
+                    if (MAX_DELTA_TIME_MS != 0) {
+                        const int64_t maxDelta = MAX_DELTA_TIME_MS;
+                        if (deltaMs > maxDelta) deltaMs = maxDelta;
+                        if (deltaMs < -maxDelta) deltaMs = -maxDelta;
+                    }
+                    node.deltaMs = static_cast<int32_t>(deltaMs);
+                    if (node.deltaMs != 0) activate(nodes, node.child[0], t);
+                    break;
+                }
+                case SignalOp::LOOPING_NOISE:
+                    // The speed is read once, at epoch 0, to fix the loop span.
+                    if (!(node.flags & kPrimed)) activate(nodes, node.child[0], 0);
+                    break;
+                case SignalOp::NOISE:
+                case SignalOp::SCALE:
+                    activate(nodes, node.child[0], t);
+                    break;
+                case SignalOp::SMAP:
+                    activate(nodes, node.child[0], t);
+                    activate(nodes, node.child[1], t);
+                    activate(nodes, node.child[2], t);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Children first: every value a node reads was computed earlier in this loop.
+        for (uint16_t i = nodeCount_; i-- > 0;) {
+            SignalNode &node = nodes[i];
+            if (!(node.flags & kActive)) continue;
+            node.value = (node.flags & kLive) ? nodeValue(node, nodes, waveforms, node.timeMs) : 0;
+        }
+        return s0x16(nodes[0].value);
+    }
+
+    SignalProgram S0x16Signal::takeProgram() && {
+        if (constant_) {
+            SignalNode node;
+            node.a = constantRaw_;
+            return SignalProgram::leaf(node);
+        }
+        if (program_) return std::move(program_);
+        if (waveformFn) return SignalProgram::waveform(kind_, loopMode_, durationMs_, std::move(waveformFn));
+        return SignalProgram::leaf(SignalNode{});
+    }
+}
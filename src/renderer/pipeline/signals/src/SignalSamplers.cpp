@@ -30,45 +30,54 @@ namespace PolarShader {
         };
     }
 
+    s0x16 noise32At(uint32_t phase) {
+        // inoise16 for 1D uses a 32-bit coordinate (16.16)
+        NoiseRawU0x16 rawNoise = NoiseRawU0x16(inoise16(phase << 5));
+        return toSigned(u0x16(raw(rawNoise)));
+    }
+
+    s0x16 sineAt(u0x16 phase) {
+        // sin16 expects 0-65535 for a full circle.
+        // Result is signed 16-bit [-32768, 32767].
+        int32_t s = sin16(raw(phase));
+        return s0x16(s << 1);
+    }
+
+    s0x16 triangleAt(u0x16 phase) {
+        uint32_t p = raw(phase);
+        if (p < 0x8000) {
+            // 0 -> -1, 0.25 -> 0, 0.5 -> 1
+            return s0x16(static_cast<int32_t>(p << 2) - 65536);
+        }
+        // 0.5 -> 1, 0.75 -> 0, 1.0 -> -1
+        return s0x16(196608 - static_cast<int32_t>(p << 2));
+    }
+
+    s0x16 squareAt(u0x16 phase) {
+        return (raw(phase) < 0x8000) ? s0x16(S0X16_MAX) : s0x16(S0X16_MIN);
+    }
+
+    s0x16 sawtoothAt(u0x16 phase) {
+        return toSigned(phase);
+    }
+
     SampleSignal32 sampleNoise32() {
-        return [](uint32_t phase) -> s0x16 {
-            // inoise16 for 1D uses a 32-bit coordinate (16.16)
-            NoiseRawU0x16 rawNoise = NoiseRawU0x16(inoise16(phase << 5));
-            return toSigned(u0x16(raw(rawNoise)));
-        };
+        return [](uint32_t phase) -> s0x16 { return noise32At(phase); };
     }
 
     SampleSignal sampleSine() {
-        return [](u0x16 phase) -> s0x16 {
-            // sin16 expects 0-65535 for a full circle.
-            // Result is signed 16-bit [-32768, 32767].
-            int32_t s = sin16(raw(phase));
-            return s0x16(s << 1);
-        };
+        return [](u0x16 phase) -> s0x16 { return sineAt(phase); };
     }
 
     SampleSignal sampleTriangle() {
-        return [](u0x16 phase) -> s0x16 {
-            uint32_t p = raw(phase);
-            if (p < 0x8000) {
-                // 0 -> -1, 0.25 -> 0, 0.5 -> 1
-                return s0x16(static_cast<int32_t>(p << 2) - 65536);
-            } else {
-                // 0.5 -> 1, 0.75 -> 0, 1.0 -> -1
-                return s0x16(196608 - static_cast<int32_t>(p << 2));
-            }
-        };
+        return [](u0x16 phase) -> s0x16 { return triangleAt(phase); };
     }
 
     SampleSignal sampleSquare() {
-        return [](u0x16 phase) -> s0x16 {
-            return (raw(phase) < 0x8000) ? s0x16(S0X16_MAX) : s0x16(S0X16_MIN);
-        };
+        return [](u0x16 phase) -> s0x16 { return squareAt(phase); };
     }
 
     SampleSignal sampleSawtooth() {
-        return [](u0x16 phase) -> s0x16 {
-            return toSigned(phase);
-        };
+        return [](u0x16 phase) -> s0x16 { return sawtoothAt(phase); };
     }
 }
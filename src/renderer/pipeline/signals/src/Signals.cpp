@@ -19,8 +19,6 @@
  */
 
 #include "renderer/pipeline/signals/Signals.h"
-#include "renderer/pipeline/signals/accumulators/Accumulators.h"
-#include "renderer/pipeline/signals/SignalSamplers.h"
 #include "renderer/pipeline/maths/ScalarMaths.h"
 #include "renderer/pipeline/signals/ranges/MagnitudeRange.h"
 #include "renderer/pipeline/signals/ranges/UVRange.h"
@@ -52,50 +50,50 @@ namespace PolarShader {
             return raw(phaseOffset) == 0 ? randomPhaseOffset() : phaseOffset;
         }
 
-        u0x16 timeToProgress(TimeMillis t, TimeMillis duration) {
-            if (duration == 0) return u0x16(0);
-            if (t >= duration) t = duration;
-            uint64_t scaled = (static_cast<uint64_t>(t) * UINT16_MAX) / duration;
-            if (scaled > UINT16_MAX) scaled = UINT16_MAX;
-            return u0x16(static_cast<uint16_t>(scaled));
-        }
-
         S0x16Signal createAperiodicSignal(
             TimeMillis duration,
             LoopMode loopMode,
-            Waveform waveform
+            SignalOp easing
         ) {
-            return S0x16Signal(SignalKind::APERIODIC, loopMode, duration, std::move(waveform));
+            SignalNode node;
+            node.op = easing;
+            node.kind = SignalKind::APERIODIC;
+            node.loopMode = loopMode;
+            node.durationMs = duration;
+            return S0x16Signal(SignalProgram::leaf(node), SignalEvaluation::CLOSED_FORM);
         }
 
         S0x16Signal createPeriodicSignal(
             S0x16Signal phaseVelocity,
             s0x16 phaseOffset,
-            SampleSignal sample
+            PeriodicShape shape
         ) {
-            PhaseAccumulator acc(
-                [phaseVelocity = std::move(phaseVelocity)](TimeMillis elapsedMs) mutable -> s0x16 {
-                    return phaseVelocity.sample(magnitudeRange(), elapsedMs);
-                },
-                wrapPhaseOffset(phaseOffset)
-            );
+            SignalNode node;
+            node.shape = shape;
+            node.a = raw(wrapPhaseOffset(phaseOffset));
+
+            if (phaseVelocity.evaluation() == SignalEvaluation::CONSTANT) {
+                // A constant rate integrates to a straight line, so the phase is evaluated in
+                // closed form and the signal can be sampled at any time without replaying frames.
+                node.op = SignalOp::PERIODIC;
+                node.b = raw(phaseVelocity.sample(magnitudeRange(), 0));
+                if (node.b == 0) return S0x16Signal::fixed(SignalProgram::fold(node, nullptr, 0));
+                return S0x16Signal(SignalProgram::leaf(node), SignalEvaluation::CLOSED_FORM);
+            }
 
-            return S0x16Signal(
-                SignalKind::PERIODIC,
-                [
-                    acc = std::move(acc),
-                    sample = std::move(sample)
-                ](TimeMillis elapsedMs) mutable -> s0x16 {
-                    return sample(acc.advance(elapsedMs));
-                }
-            );
+            node.op = SignalOp::PERIODIC_INTEGRATED;
+            node.phaseRaw32 = static_cast<uint32_t>(node.a) << 16;
+            return S0x16Signal(SignalProgram::compose(node, &phaseVelocity, 1), SignalEvaluation::INTEGRATED);
         }
 
         S0x16Signal constantRaw(int32_t value) {
-            return S0x16Signal(
-                SignalKind::PERIODIC,
-                [value](TimeMillis) { return s0x16(value); }
-            );
+            return S0x16Signal::fixed(s0x16(value));
+        }
+
+        // Noise that never moves along its path samples one fixed point of the field.
+        bool isStillVelocity(const S0x16Signal &phaseVelocity) {
+            return phaseVelocity.evaluation() == SignalEvaluation::CONSTANT &&
+                   raw(phaseVelocity.sample(magnitudeRange(), 0)) == 0;
         }
     }
 
@@ -122,40 +120,19 @@ namespace PolarShader {
     }
 
     S0x16Signal linear(TimeMillis duration, LoopMode loopMode) {
-        return createAperiodicSignal(duration, loopMode, [duration](TimeMillis t) {
-            uint32_t progressRaw = raw(timeToProgress(t, duration));
-            return toSigned(u0x16(progressRaw));
-        });
+        return createAperiodicSignal(duration, loopMode, SignalOp::LINEAR);
     }
 
     S0x16Signal quadraticIn(TimeMillis duration, LoopMode loopMode) {
-        return createAperiodicSignal(duration, loopMode, [duration](TimeMillis t) {
-            uint32_t p = raw(timeToProgress(t, duration));
-            uint32_t result = (static_cast<uint64_t>(p) * p + (1u << 15)) >> 16;
-            return toSigned(u0x16(result));
-        });
+        return createAperiodicSignal(duration, loopMode, SignalOp::QUADRATIC_IN);
     }
 
     S0x16Signal quadraticOut(TimeMillis duration, LoopMode loopMode) {
-        return createAperiodicSignal(duration, loopMode, [duration](TimeMillis t) {
-            uint32_t p = raw(timeToProgress(t, duration));
-            uint32_t inv = 0xFFFFu - p;
-            uint32_t result = 0xFFFFu - ((static_cast<uint64_t>(inv) * inv + (1u << 15)) >> 16);
-            return toSigned(u0x16(result));
-        });
+        return createAperiodicSignal(duration, loopMode, SignalOp::QUADRATIC_OUT);
     }
 
     S0x16Signal quadraticInOut(TimeMillis duration, LoopMode loopMode) {
-        return createAperiodicSignal(duration, loopMode, [duration](TimeMillis t) {
-            uint32_t p = raw(timeToProgress(t, duration));
-            if (p < 0x8000u) {
-                uint32_t result = (static_cast<uint64_t>(p) * p + (1u << 14)) >> 15;
-                return toSigned(u0x16(result));
-            }
-            uint32_t inv = 0xFFFFu - p;
-            uint32_t tail = (static_cast<uint64_t>(inv) * inv + (1u << 14)) >> 15;
-            return toSigned(u0x16(0xFFFFu - tail));
-        });
+        return createAperiodicSignal(duration, loopMode, SignalOp::QUADRATIC_IN_OUT);
     }
 
     S0x16Signal noise(
@@ -164,71 +141,33 @@ namespace PolarShader {
         TimeMillis loopPeriodMs
     ) {
         phaseOffset = resolveNoisePhaseOffset(phaseOffset);
-        const uint32_t phaseOffsetRaw = static_cast<uint32_t>(raw(wrapPhaseOffset(phaseOffset))) << 16;
+
+        SignalNode node;
+        node.a = static_cast<int32_t>(static_cast<uint32_t>(raw(wrapPhaseOffset(phaseOffset))) << 16);
+        if (isStillVelocity(phaseVelocity)) {
+            node.op = SignalOp::NOISE;
+            return S0x16Signal::fixed(SignalProgram::fold(node, &phaseVelocity, 1));
+        }
 
         if (loopPeriodMs > 0) {
             // Seamless loop via a two-path cross-dissolve (same technique as the
             // looping noise pattern): out(phi) = lerp(noise(cA), noise(cB), w(phi))
             // with cA = base + phi*span, cB = cA - span, and a monotonic 0->1
             // weight, so out(0) == out(1). The random phaseOffset (base) gives each
-            // looping signal its own path through the field.
-            return S0x16Signal(
-                SignalKind::PERIODIC,
-                [
-                    phaseVelocity = std::move(phaseVelocity),
-                    phaseOffsetRaw,
-                    loopPeriodMs,
-                    sampler = sampleNoise32(),
-                    span = static_cast<uint32_t>(0),
-                    spanReady = false
-                ](TimeMillis elapsedMs) mutable -> s0x16 {
-                    if (!spanReady) {
-                        // Sample velocity ONCE at epoch 0 so the span (hence the
-                        // seam) is a fixed function of absolute time, matching the
-                        // pattern's loop. At phaseVelocity 1.0 the coordinate
-                        // advances by 1 per millisecond, so one period spans P*v.
-                        const uint32_t vel = static_cast<uint32_t>(
-                            raw(phaseVelocity.sample(magnitudeRange(), 0u)));
-                        span = static_cast<uint32_t>(
-                            (static_cast<uint64_t>(loopPeriodMs) * vel) >> 16);
-                        spanReady = true;
-                    }
-
-                    const uint16_t phi_raw = static_cast<uint16_t>(
-                        static_cast<uint64_t>(elapsedMs % loopPeriodMs) * 65535u / loopPeriodMs);
-                    const uint32_t coordA = phaseOffsetRaw +
-                        static_cast<uint32_t>((static_cast<uint64_t>(phi_raw) * span) >> 16);
-                    const uint32_t coordB = coordA - span;
-
-                    int32_t w = 32767 - static_cast<int32_t>(cos16(static_cast<uint16_t>(phi_raw >> 1)));
-                    if (w < 0) w = 0;
-                    if (w > 65535) w = 65535;
-
-                    const int32_t a = raw(sampler(coordA));
-                    const int32_t b = raw(sampler(coordB));
-                    const int32_t out = a + static_cast<int32_t>(
-                        (static_cast<int64_t>(b - a) * w) >> 16);
-                    return s0x16(out);
-                }
-            );
+            // looping signal its own path through the field. Velocity is sampled
+            // once at epoch 0, so the span (hence the seam) is a fixed function of
+            // absolute time and every later sample is closed-form.
+            node.op = SignalOp::LOOPING_NOISE;
+            node.b = static_cast<int32_t>(loopPeriodMs);
+            return S0x16Signal(SignalProgram::compose(node, &phaseVelocity, 1), SignalEvaluation::CLOSED_FORM);
         }
 
-        return S0x16Signal(
-            SignalKind::PERIODIC,
-            [
-                phaseVelocity = std::move(phaseVelocity),
-                phaseOffsetRaw,
-                sampler = sampleNoise32()
-            ](TimeMillis elapsedMs) mutable -> s0x16 {
-                s0x16 s = phaseVelocity.sample(magnitudeRange(), elapsedMs);
-
-                // Noise coordinate is driven by elapsed time scaled by the sampled phase velocity.
-                // At phaseVelocity 1.0 (65536), the coordinate advances by 1 per millisecond.
-                uint64_t coord64 = (static_cast<uint64_t>(elapsedMs) * static_cast<uint32_t>(raw(s))) >> 16;
-                uint32_t coord = static_cast<uint32_t>(coord64);
-                return sampler(coord + phaseOffsetRaw);
-            }
-        );
+        // Noise reads its velocity at the sampled time rather than integrating it, so it stays
+        // closed-form whenever the velocity does.
+        const SignalEvaluation evaluation = combineEvaluation(
+            phaseVelocity.evaluation(), SignalEvaluation::CLOSED_FORM);
+        node.op = SignalOp::NOISE;
+        return S0x16Signal(SignalProgram::compose(node, &phaseVelocity, 1), evaluation);
     }
 
     S0x16Signal noise(
@@ -265,7 +204,7 @@ namespace PolarShader {
         return createPeriodicSignal(
             std::move(phaseVelocity),
             phaseOffset,
-            sampleSine()
+            PeriodicShape::SINE
         );
     }
 
@@ -301,7 +240,7 @@ namespace PolarShader {
         return createPeriodicSignal(
             std::move(phaseVelocity),
             phaseOffset,
-            sampleTriangle()
+            PeriodicShape::TRIANGLE
         );
     }
 
@@ -337,7 +276,7 @@ namespace PolarShader {
         return createPeriodicSignal(
             std::move(phaseVelocity),
             phaseOffset,
-            sampleSquare()
+            PeriodicShape::SQUARE
         );
     }
 
@@ -373,7 +312,7 @@ namespace PolarShader {
         return createPeriodicSignal(
             std::move(phaseVelocity),
             phaseOffset,
-            sampleSawtooth()
+            PeriodicShape::SAWTOOTH
         );
     }
 
@@ -404,54 +343,43 @@ namespace PolarShader {
 
     S0x16Signal scale(S0x16Signal signal, u0x16 factor) {
         if (!signal) return signal;
+        const SignalEvaluation evaluation = signal.evaluation();
 
-        auto waveform = [signal = std::move(signal), factor](TimeMillis elapsedMs) mutable {
-            return mulS0x16Sat(signal.sample(bipolarRange(), elapsedMs), s0x16(raw(factor)));
-        };
-
+        // Keep the source's aperiodic window so it still sees the same relative time.
+        SignalNode node;
+        node.op = SignalOp::SCALE;
         if (signal.kind() == SignalKind::APERIODIC) {
-            return S0x16Signal(
-                SignalKind::APERIODIC,
-                signal.loopMode(),
-                signal.duration(),
-                std::move(waveform)
-            );
+            node.kind = SignalKind::APERIODIC;
+            node.loopMode = signal.loopMode();
+            node.durationMs = signal.duration();
         }
-        return S0x16Signal(SignalKind::PERIODIC, std::move(waveform));
+        node.a = static_cast<int32_t>(raw(factor));
+        if (signal.isConstant()) return S0x16Signal::fixed(SignalProgram::fold(node, &signal, 1));
+        return S0x16Signal(SignalProgram::compose(node, &signal, 1), evaluation);
     }
 
     S0x16Signal smap(S0x16Signal signal, S0x16Signal floor, S0x16Signal ceiling) {
         if (!signal) return signal;
         if (!floor) floor = constant(0);
         if (!ceiling) ceiling = constant(1000);
+        const SignalEvaluation evaluation = combineEvaluation(
+            signal.evaluation(),
+            combineEvaluation(floor.evaluation(), ceiling.evaluation())
+        );
 
-        auto waveform = [
-                    signal = std::move(signal),
-                    floor = std::move(floor),
-                    ceiling = std::move(ceiling)
-                ](TimeMillis elapsedMs) mutable -> s0x16 {
-            // Bounds live in the unipolar domain and may animate independently over time.
-            uint32_t floorRaw = static_cast<uint32_t>(raw(floor.sample(magnitudeRange(), elapsedMs)));
-            uint32_t ceilingRaw = static_cast<uint32_t>(raw(ceiling.sample(magnitudeRange(), elapsedMs)));
-            if (floorRaw > ceilingRaw) {
-                std::swap(floorRaw, ceilingRaw);
-            }
-
-            const uint32_t sourceRaw = raw(toUnsignedClamped(signal.sample(bipolarRange(), elapsedMs)));
-            const uint32_t span = ceilingRaw - floorRaw;
-            const uint32_t mappedRaw = floorRaw + ((span * sourceRaw + (1u << 15)) >> 16);
-            return toSigned(u0x16(static_cast<uint16_t>(mappedRaw)));
-        };
-
+        // Bounds live in the unipolar domain and may animate independently over time.
+        SignalNode node;
+        node.op = SignalOp::SMAP;
         if (signal.kind() == SignalKind::APERIODIC) {
-            return S0x16Signal(
-                SignalKind::APERIODIC,
-                signal.loopMode(),
-                signal.duration(),
-                std::move(waveform)
-            );
+            node.kind = SignalKind::APERIODIC;
+            node.loopMode = signal.loopMode();
+            node.durationMs = signal.duration();
+        }
+        S0x16Signal children[3] = {std::move(signal), std::move(floor), std::move(ceiling)};
+        if (children[0].isConstant() && children[1].isConstant() && children[2].isConstant()) {
+            return S0x16Signal::fixed(SignalProgram::fold(node, children, 3));
         }
-        return S0x16Signal(SignalKind::PERIODIC, std::move(waveform));
+        return S0x16Signal(SignalProgram::compose(node, children, 3), evaluation);
     }
 
     UVSignal constantUV(UV value) {
@@ -62,4 +62,16 @@ namespace PolarShader {
 
         return phaseRaw32;
     }
+
+    uint32_t phaseAtConstantSpeedRaw(u0x16 initialPhase, s0x16 speed, TimeMillis elapsedMs) {
+        // Split t into whole seconds and a millisecond remainder so speed * t * 65536 never
+        // overflows: each whole second adds exactly speed * 65536, which wraps harmlessly.
+        const int64_t speedRaw = raw(speed);
+        const uint32_t seconds = static_cast<uint32_t>(elapsedMs / 1000u);
+        const int64_t remainderMs = static_cast<int64_t>(elapsedMs % 1000u);
+
+        const uint32_t whole = (static_cast<uint32_t>(speedRaw) * seconds) << 16;
+        const int64_t partial = (speedRaw * remainderMs * 65536LL + 500LL) / 1000LL;
+        return (static_cast<uint32_t>(raw(initialPhase)) << 16) + whole + static_cast<uint32_t>(partial);
+    }
 }
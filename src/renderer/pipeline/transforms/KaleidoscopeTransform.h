@@ -32,12 +32,17 @@ namespace PolarShader {
         struct State;
         // Pure warp applied via a DIRECT static call (see WASM ABI NOTE in Units.h).
         static UV warp(const State &state, UV uv);
+        static UV polarEdit(const State &state, UV polar_uv);
         std::shared_ptr<State> state;
 
     public:
         KaleidoscopeTransform(uint8_t nbFacets, bool isMirrored);
 
         UVLayer apply(const UVLayer &layer) const override;
+
+        PolarWarp polarWarp() const override;
+
+        bool repeatsSamples() const override { return true; }
     };
 }
 
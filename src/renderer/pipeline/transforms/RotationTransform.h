@@ -39,6 +39,8 @@ namespace PolarShader {
 
         UVLayer apply(const UVLayer &layer) const override;
 
+        PolarWarp polarWarp() const override;
+
     private:
         struct MappedInputs;
         static MappedInputs makeInputs(S0x16Signal angle, bool isAngleTurn);
@@ -46,6 +48,7 @@ namespace PolarShader {
         struct State;
         // Pure warp applied via a DIRECT static call (see WASM ABI NOTE in Units.h).
         static UV warp(const State &state, UV uv);
+        static UV polarEdit(const State &state, UV polar_uv);
         std::shared_ptr<State> state;
     };
 }
@@ -42,6 +42,8 @@ namespace PolarShader {
 
         UVLayer apply(const UVLayer &layer) const override;
 
+        bool repeatsSamples() const override { return true; }
+
     private:
         struct MappedInputs;
         static MappedInputs makeInputs(S0x16Signal scale);
@@ -47,43 +47,138 @@ namespace PolarShader {
     /** @brief Full-RGB UV sampling interface with an independent brightness channel. */
     using UVRgbMap = fl::function<RgbSample(UV)>;
 
+    /**
+     * @brief Span sampling interfaces: out[i] = map(uvs[i]) for i in [0, count).
+     *
+     * A span pays each stage's fl::function dispatch once per batch instead of
+     * once per pixel. `uvs` is caller-owned scratch: transform stages warp it in
+     * place before handing it to the next stage, so callers must not reuse its
+     * contents afterwards. Only pointers cross the type-erased boundary, so the
+     * WASM ABI NOTE on `UV` in Units.h does not apply here.
+     */
+    using UVSpanMap = fl::function<void(UV *uvs, PatternNormU0x16 *out, uint16_t count)>;
+
+    /** @brief Span form of UVColourMap. */
+    using UVColourSpanMap = fl::function<void(UV *uvs, PaletteSample *out, uint16_t count)>;
+
+    /** @brief Span form of UVRgbMap. */
+    using UVRgbSpanMap = fl::function<void(UV *uvs, RgbSample *out, uint16_t count)>;
+
+    /**
+     * @brief Maximum number of pixels a span caller batches at once.
+     *
+     * Bounds the stack scratch (UVs, samples, colours) each span caller keeps;
+     * 32 pixels is ~0.5 KB for the largest (RGB) batch.
+     */
+    inline constexpr uint16_t SPAN_CHUNK_SIZE = 32;
+
+    /**
+     * @brief Builds a span sampler around a per-pixel map.
+     *
+     * When `map` is a concrete functor the per-pixel call inlines into the
+     * loop; when it is an fl::function this is the per-pixel fallback.
+     */
+    template<typename Sample, typename Map>
+    fl::function<void(UV *, Sample *, uint16_t)> makeUvSpan(Map map) {
+        return [map = std::move(map)](UV *uvs, Sample *out, uint16_t count) {
+            for (uint16_t i = 0; i < count; ++i) {
+                out[i] = map(uvs[i]);
+            }
+        };
+    }
+
     enum class UVLayerKind : uint8_t {
         Scalar,
         Palette,
         Rgb
     };
 
+    /**
+     * @brief A compiled UV leaf in both per-pixel and span form.
+     *
+     * Both forms sample the same field; the span form is what Layer compiles
+     * for rendering, the per-pixel form is kept for direct sampling and tests.
+     * Factories taking an fl::function derive the span form as a per-pixel
+     * fallback; factories taking a concrete functor inline it into both.
+     */
     struct UVLayer {
         UVLayerKind kind{UVLayerKind::Scalar};
         UVMap scalar;
         UVColourMap palette;
         UVRgbMap rgb;
+        UVSpanMap scalarSpan;
+        UVColourSpanMap paletteSpan;
+        UVRgbSpanMap rgbSpan;
 
-        static UVLayer fromScalar(UVMap map) {
+        static UVLayer fromScalar(UVMap map, UVSpanMap span) {
             UVLayer layer;
             layer.kind = UVLayerKind::Scalar;
             layer.scalar = std::move(map);
+            layer.scalarSpan = std::move(span);
             return layer;
         }
 
-        static UVLayer fromPalette(UVColourMap map) {
+        static UVLayer fromPalette(UVColourMap map, UVColourSpanMap span) {
             UVLayer layer;
             layer.kind = UVLayerKind::Palette;
             layer.palette = std::move(map);
+            layer.paletteSpan = std::move(span);
             return layer;
         }
 
-        static UVLayer fromRgb(UVRgbMap map) {
+        static UVLayer fromRgb(UVRgbMap map, UVRgbSpanMap span) {
             UVLayer layer;
             layer.kind = UVLayerKind::Rgb;
             layer.rgb = std::move(map);
+            layer.rgbSpan = std::move(span);
             return layer;
         }
+
+        static UVLayer fromScalar(UVMap map) {
+            UVSpanMap span = map ? makeUvSpan<PatternNormU0x16>(map) : UVSpanMap();
+            return fromScalar(std::move(map), std::move(span));
+        }
+
+        static UVLayer fromPalette(UVColourMap map) {
+            UVColourSpanMap span = map ? makeUvSpan<PaletteSample>(map) : UVColourSpanMap();
+            return fromPalette(std::move(map), std::move(span));
+        }
+
+        static UVLayer fromRgb(UVRgbMap map) {
+            UVRgbSpanMap span = map ? makeUvSpan<RgbSample>(map) : UVRgbSpanMap();
+            return fromRgb(std::move(map), std::move(span));
+        }
+
+        template<typename Functor>
+        static UVLayer fromScalar(Functor functor) {
+            return fromScalar(UVMap(functor), makeUvSpan<PatternNormU0x16>(functor));
+        }
+
+        template<typename Functor>
+        static UVLayer fromPalette(Functor functor) {
+            return fromPalette(UVColourMap(functor), makeUvSpan<PaletteSample>(functor));
+        }
+
+        template<typename Functor>
+        static UVLayer fromRgb(Functor functor) {
+            return fromRgb(UVRgbMap(functor), makeUvSpan<RgbSample>(functor));
+        }
     };
 
     // THREAD-SAFETY: ColourMap is called concurrently from multiple cores.
     // All functions in its call chain must be pure (no mutable static locals, no global writes).
     using ColourMap = fl::function<CRGB(const RenderPoint&)>;
+
+    // Span form of ColourMap: out[i] = map(points[i]) for i in [0, count).
+    // `cartesian` optionally supplies polarToCartesianUV(points[i]) precomputed
+    // by the display (see PolarRenderer); pass nullptr to have UV layers
+    // convert on the fly. Same THREAD-SAFETY contract as ColourMap.
+    using ColourSpanMap = fl::function<void(
+        const RenderPoint *points,
+        const UV *cartesian,
+        CRGB *out,
+        uint16_t count
+    )>;
 }
 
 #endif //POLAR_SHADER_TRANSFORMS_BASE_LAYERS_H
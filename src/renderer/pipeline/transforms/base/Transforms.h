@@ -41,6 +41,26 @@ namespace PolarShader {
         std::shared_ptr<PipelineContext> context;
     };
 
+    /**
+     * @brief Span form of a transform stage: warps the batch in place, then
+     * hands it to the source span in a single call.
+     */
+    template<typename Sample, typename State, typename WarpFn>
+    fl::function<void(UV *, Sample *, uint16_t)> composeUvSpan(
+        fl::function<void(UV *, Sample *, uint16_t)> source,
+        std::shared_ptr<State> state,
+        WarpFn warp
+    ) {
+        if (!source) return {};
+        return [state = std::move(state), source = std::move(source), warp](UV *uvs, Sample *out, uint16_t count) {
+            const State &current = *state;
+            for (uint16_t i = 0; i < count; ++i) {
+                uvs[i] = warp(current, uvs[i]);
+            }
+            source(uvs, out, count);
+        };
+    }
+
     template<typename State, typename WarpFn>
     UVLayer composeUvLayer(
         const UVLayer &layer,
@@ -49,21 +69,56 @@ namespace PolarShader {
     ) {
         switch (layer.kind) {
             case UVLayerKind::Palette:
-                return UVLayer::fromPalette([state = std::move(state), source = layer.palette, warp](UV uv) {
-                    return source(warp(*state, uv));
-                });
+                return UVLayer::fromPalette(
+                    [state, source = layer.palette, warp](UV uv) {
+                        return source(warp(*state, uv));
+                    },
+                    composeUvSpan<PaletteSample>(layer.paletteSpan, state, warp)
+                );
             case UVLayerKind::Rgb:
-                return UVLayer::fromRgb([state = std::move(state), source = layer.rgb, warp](UV uv) {
-                    return source(warp(*state, uv));
-                });
+                return UVLayer::fromRgb(
+                    [state, source = layer.rgb, warp](UV uv) {
+                        return source(warp(*state, uv));
+                    },
+                    composeUvSpan<RgbSample>(layer.rgbSpan, state, warp)
+                );
             case UVLayerKind::Scalar:
             default:
-                return UVLayer::fromScalar([state = std::move(state), source = layer.scalar, warp](UV uv) {
-                    return source(warp(*state, uv));
-                });
+                return UVLayer::fromScalar(
+                    [state, source = layer.scalar, warp](UV uv) {
+                        return source(warp(*state, uv));
+                    },
+                    composeUvSpan<PatternNormU0x16>(layer.scalarSpan, state, warp)
+                );
         }
     }
 
+    /** @brief In-place edit of a batch of polar UVs (angle = u, radius = v). */
+    using PolarWarpSpan = fl::function<void(UV *polar, uint16_t count)>;
+
+    /**
+     * @brief Polar form of a transform whose warp is cartesianToPolarUV ->
+     * edit -> polarToCartesianUV (see UVTransform::polarWarp).
+     */
+    struct PolarWarp {
+        PolarWarpSpan span;
+        // The Cartesian warp mirrors its input into [0, 1] before converting.
+        bool mirrorsInput = false;
+    };
+
+    template<typename State, typename EditFn>
+    PolarWarp makePolarWarp(std::shared_ptr<State> state, EditFn edit, bool mirrorsInput = false) {
+        PolarWarp polar;
+        polar.span = [state = std::move(state), edit](UV *uvs, uint16_t count) {
+            const State &current = *state;
+            for (uint16_t i = 0; i < count; ++i) {
+                uvs[i] = edit(current, uvs[i]);
+            }
+        };
+        polar.mirrorsInput = mirrorsInput;
+        return polar;
+    }
+
     /**
      * @brief Standard interface for all spatial transformations in the unified UV pipeline.
      * 
@@ -92,6 +147,24 @@ namespace PolarShader {
          */
         virtual UVLayer apply(const UVLayer &layer) const = 0;
 
+        /**
+         * @brief The polar edit inside apply()'s warp, for polar-native transforms.
+         *
+         * Layer::compileSpan() fuses adjacent polar-native steps so a batch is
+         * converted to polar once per run rather than once per step. Empty for
+         * transforms that work in Cartesian space.
+         */
+        virtual PolarWarp polarWarp() const { return {}; }
+
+        /**
+         * @brief Whether the warp lands many pixels on the same or nearby
+         * pattern coordinates, by folding or magnifying the plane.
+         *
+         * Layer passes this to UVPattern::setSampleReuse() so a pattern only
+         * keeps memo state where neighbouring samples can share work.
+         */
+        virtual bool repeatsSamples() const { return false; }
+
         UVMap operator()(const UVMap &layer) const {
             return apply(UVLayer::fromScalar(layer)).scalar;
         }
@@ -34,8 +34,10 @@ namespace PolarShader {
     }
 
     UV KaleidoscopeTransform::warp(const State &state, UV uv) {
-        UV polar_uv = cartesianToPolarUV(mirrorUv(uv));
+        return polarToCartesianUV(polarEdit(state, cartesianToPolarUV(mirrorUv(uv))));
+    }
 
+    UV KaleidoscopeTransform::polarEdit(const State &state, UV polar_uv) {
         uint8_t facets = state.facets;
         if (facets > 1u) {
             uint32_t full_turn = ANGLE_FULL_TURN_U32;
@@ -54,7 +56,7 @@ namespace PolarShader {
             }
         }
 
-        return polarToCartesianUV(polar_uv);
+        return polar_uv;
     }
 
     UVLayer KaleidoscopeTransform::apply(const UVLayer &layer) const {
@@ -62,4 +64,10 @@ namespace PolarShader {
             return warp(state, uv);
         });
     }
+
+    PolarWarp KaleidoscopeTransform::polarWarp() const {
+        return makePolarWarp(state, [](const State &state, UV polar_uv) {
+            return polarEdit(state, polar_uv);
+        }, true);
+    }
 }
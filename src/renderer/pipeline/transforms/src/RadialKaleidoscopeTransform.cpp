@@ -33,8 +33,10 @@ namespace PolarShader {
     }
 
     UV RadialKaleidoscopeTransform::warp(const State &state, UV uv) {
-        UV polar_uv = cartesianToPolarUV(mirrorUv(uv));
+        return polarToCartesianUV(polarEdit(state, cartesianToPolarUV(mirrorUv(uv))));
+    }
 
+    UV RadialKaleidoscopeTransform::polarEdit(const State &state, UV polar_uv) {
         uint32_t divisions = state.divisions;
         if (divisions > 1u) {
             uint32_t full_radius = static_cast<uint32_t>(S0X16_MAX) + 1u;
@@ -55,7 +57,7 @@ namespace PolarShader {
             }
         }
 
-        return polarToCartesianUV(polar_uv);
+        return polar_uv;
     }
 
     UVLayer RadialKaleidoscopeTransform::apply(const UVLayer &layer) const {
@@ -63,4 +65,10 @@ namespace PolarShader {
             return warp(state, uv);
         });
     }
+
+    PolarWarp RadialKaleidoscopeTransform::polarWarp() const {
+        return makePolarWarp(state, [](const State &state, UV polar_uv) {
+            return polarEdit(state, polar_uv);
+        }, true);
+    }
 }
@@ -77,16 +77,16 @@ namespace PolarShader {
     }
 
     UV RotationTransform::warp(const State &state, UV uv) {
-        // Convert to Polar UV (Angle=U, Radius=V)
-        UV polar_uv = cartesianToPolarUV(uv);
+        // Convert to Polar UV (Angle=U, Radius=V), rotate, convert back
+        return polarToCartesianUV(polarEdit(state, cartesianToPolarUV(uv)));
+    }
 
+    UV RotationTransform::polarEdit(const State &state, UV polar_uv) {
         // Apply rotation to U (angle)
         uint16_t angle_raw = static_cast<uint16_t>(polar_uv.u.raw());
         uint16_t offset_raw = raw(state.angleOffset);
         polar_uv.u = fl::s16x16::from_raw(static_cast<uint16_t>(angle_raw + offset_raw));
-
-        // Convert back to Cartesian UV
-        return polarToCartesianUV(polar_uv);
+        return polar_uv;
     }
 
     UVLayer RotationTransform::apply(const UVLayer &layer) const {
@@ -94,4 +94,10 @@ namespace PolarShader {
             return warp(state, uv);
         });
     }
+
+    PolarWarp RotationTransform::polarWarp() const {
+        return makePolarWarp(state, [](const State &state, UV polar_uv) {
+            return polarEdit(state, polar_uv);
+        });
+    }
 }
@@ -65,15 +65,16 @@ namespace PolarShader {
     }
 
     UV VortexTransform::warp(const State &state, UV uv) {
-        UV polar_uv = cartesianToPolarUV(uv);
+        return polarToCartesianUV(polarEdit(state, cartesianToPolarUV(uv)));
+    }
 
+    UV VortexTransform::polarEdit(const State &state, UV polar_uv) {
         int32_t strength_raw = raw(state.strengthValue);
         uint32_t radius_raw = static_cast<uint32_t>(polar_uv.v.raw());
         int32_t scaled = static_cast<int32_t>((static_cast<int64_t>(strength_raw) * radius_raw) >> 16);
         int32_t new_angle = polar_uv.u.raw() + scaled;
         polar_uv.u = fl::s16x16::from_raw(static_cast<uint16_t>(new_angle));
-
-        return polarToCartesianUV(polar_uv);
+        return polar_uv;
     }
 
     UVLayer VortexTransform::apply(const UVLayer &layer) const {
@@ -81,4 +82,10 @@ namespace PolarShader {
             return warp(state, uv);
         });
     }
+
+    PolarWarp VortexTransform::polarWarp() const {
+        return makePolarWarp(state, [](const State &state, UV polar_uv) {
+            return polarEdit(state, polar_uv);
+        });
+    }
 }
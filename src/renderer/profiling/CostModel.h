@@ -0,0 +1,85 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef POLAR_SHADER_COST_MODEL_H
+#define POLAR_SHADER_COST_MODEL_H
+
+#include "renderer/profiling/OpCounter.h"
+
+// Frame budget predictions are checked against (matches the firmware and
+// composer refresh interval).
+#ifndef POLAR_SHADER_FRAME_BUDGET_MS
+#define POLAR_SHADER_FRAME_BUDGET_MS 30u
+#endif
+
+namespace PolarShader {
+    /**
+     * @brief Estimated cost of each CountedOp on one board.
+     *
+     * Cycle figures are per operation including call overhead; LayerPixel
+     * stands in for all the uncounted per-pixel work of a layer (UV maths,
+     * span plumbing, blending). Calibrate against FrameProfiler on hardware.
+     */
+    struct BoardCostTable {
+        const char *name; // PlatformIO env
+        uint32_t clockHz;
+        uint16_t cyclesPerOp[COUNTED_OP_COUNT];
+        // Cores sharing the render stage (the advance stage runs on one).
+        uint8_t renderCores;
+        // LED output time, and whether it runs alongside the next render.
+        uint16_t showNanosPerLed;
+        bool showOverlapsRender;
+    };
+
+    struct FramePrediction {
+        uint32_t advanceMicros{0};
+        uint32_t renderMicros{0};
+        uint32_t showMicros{0};
+        uint32_t frameMicros{0};
+        // Frames per second in tenths, e.g. 142 for 14.2 fps.
+        uint16_t fpsTenths{0};
+        bool withinBudget{true};
+    };
+
+    extern const BoardCostTable BOARD_COST_TABLES[];
+    extern const size_t BOARD_COST_TABLE_COUNT;
+
+    const BoardCostTable *findBoardCostTable(const char *name);
+
+    // `advance` and `render` are per-frame counts (see OpCounts::perFrame).
+    FramePrediction predictFrame(
+        const BoardCostTable &board,
+        const OpCounts &advance,
+        const OpCounts &render,
+        uint16_t nbLeds
+    );
+
+    // One line per board: "name frame_ms fps [over budget]". Returns the
+    // length written, truncating to `capacity`.
+    size_t formatPredictionReport(
+        const OpCounts &advance,
+        const OpCounts &render,
+        uint16_t nbLeds,
+        char *buffer,
+        size_t capacity
+    );
+}
+
+#endif // POLAR_SHADER_COST_MODEL_H
@@ -0,0 +1,150 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef POLAR_SHADER_FRAME_PROFILER_H
+#define POLAR_SHADER_FRAME_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Opt-in frame profiler. When 0 every POLAR_SHADER_PROFILE_* hook compiles
+// to nothing and the profiler's tables are not linked in.
+#ifndef POLAR_SHADER_PROFILE
+#define POLAR_SHADER_PROFILE 0
+#endif
+
+// Distinct (stage, name, step) components tracked; later ones are dropped.
+#ifndef POLAR_SHADER_PROFILE_MAX_COMPONENTS
+#define POLAR_SHADER_PROFILE_MAX_COMPONENTS 48
+#endif
+
+// Frames per rolling window. Reported min/mean/max are per-frame totals over
+// the last completed window.
+#ifndef POLAR_SHADER_PROFILE_WINDOW_FRAMES
+#define POLAR_SHADER_PROFILE_WINDOW_FRAMES 64
+#endif
+
+namespace PolarShader {
+    enum class ProfileStage : uint8_t {
+        SceneAdvance,
+        LayerAdvance,
+        LayerSample,
+        Blend,
+        Show
+    };
+
+    struct ProfileStats {
+        uint32_t min{0};
+        uint32_t mean{0};
+        uint32_t max{0};
+    };
+
+    /**
+     * @brief Per-frame tick counters for scene, layer and display stages.
+     *
+     * Components are keyed by stage, name (copied, usually Layer::getName())
+     * and pipeline step index: 0 is the layer's pattern, k the k-th
+     * PipelineStep, NO_STEP the layer as a whole. Call sites resolve a
+     * component id once and then record against it; each core accumulates
+     * into its own slot, and endFrame() folds both into the rolling window.
+     *
+     * Ticks are CPU cycles on Teensy 4.x, microseconds on other Arduino
+     * targets and in WASM, and nanoseconds natively (see tickUnit()).
+     */
+    class FrameProfiler {
+    public:
+        static constexpr uint16_t NO_COMPONENT = 0xFFFFu;
+        static constexpr uint8_t NO_STEP = 0xFFu;
+
+        static uint32_t now();
+
+        static const char *tickUnit();
+
+        // Finds or registers a component. Returns NO_COMPONENT when the
+        // table is full.
+        static uint16_t componentId(ProfileStage stage, const char *name, uint8_t step = NO_STEP);
+
+        static void record(uint16_t id, uint8_t coreIndex, uint32_t ticks);
+
+        // Closes the current frame. Returns true when this completed a window,
+        // i.e. when a fresh report is available.
+        static bool endFrame();
+
+        // Clears all statistics; registered component ids stay valid.
+        static void reset();
+
+        static uint16_t componentCount();
+
+        static ProfileStats stats(uint16_t id);
+
+        // Writes one line per component ("stage name[#step] min mean max")
+        // into `buffer`, truncating to `capacity`. Returns the length written.
+        static size_t formatReport(char *buffer, size_t capacity);
+
+        template<typename Output>
+        static void printReport(Output &out) {
+            char line[96];
+            const uint16_t count = componentCount();
+            for (uint16_t i = 0; i < count; ++i) {
+                formatLine(i, line, sizeof(line));
+                out.print(line);
+            }
+        }
+
+    private:
+        static size_t formatLine(uint16_t id, char *buffer, size_t capacity);
+    };
+
+    // Records the ticks between construction and destruction.
+    class ProfileScope {
+        uint16_t id;
+        uint8_t coreIndex;
+        uint32_t start;
+
+    public:
+        ProfileScope(uint16_t id, uint8_t coreIndex = 0)
+            : id(id), coreIndex(coreIndex), start(FrameProfiler::now()) {
+        }
+
+        ProfileScope(ProfileStage stage, const char *name, uint8_t step = FrameProfiler::NO_STEP)
+            : ProfileScope(FrameProfiler::componentId(stage, name, step)) {
+        }
+
+        ~ProfileScope() {
+            FrameProfiler::record(id, coreIndex, FrameProfiler::now() - start);
+        }
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+    };
+}
+
+#define POLAR_SHADER_PROFILE_CONCAT_INNER(a, b) a##b
+#define POLAR_SHADER_PROFILE_CONCAT(a, b) POLAR_SHADER_PROFILE_CONCAT_INNER(a, b)
+
+#if POLAR_SHADER_PROFILE
+// Times the rest of the enclosing block; arguments as for ProfileScope.
+#define POLAR_SHADER_PROFILE_SCOPE(...) \
+    ::PolarShader::ProfileScope POLAR_SHADER_PROFILE_CONCAT(polarShaderProfileScope, __LINE__)(__VA_ARGS__)
+#else
+#define POLAR_SHADER_PROFILE_SCOPE(...) do {} while (0)
+#endif
+
+#endif // POLAR_SHADER_FRAME_PROFILER_H
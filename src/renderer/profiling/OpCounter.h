@@ -0,0 +1,126 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef POLAR_SHADER_OP_COUNTER_H
+#define POLAR_SHADER_OP_COUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Instrumented build of the maths helpers: when 1, every counted operation
+// bumps a global tally that CostModel turns into per-board frame times.
+// Counting is single-threaded; enable it in native and WASM builds only.
+#ifndef POLAR_SHADER_COUNT_OPS
+#define POLAR_SHADER_COUNT_OPS 0
+#endif
+
+namespace PolarShader {
+    // Operations whose cost differs most between the supported boards.
+    enum class CountedOp : uint8_t {
+        Mul64,         // 32x32->64 multiply in the fixed-point helpers
+        Div64,         // 64-bit quotient (software divide on Cortex-M)
+        Noise,         // one inoise16 lattice evaluation
+        Trig,          // sin16 / cos16
+        PaletteLookup, // ColorFromPalette
+        LayerPixel,    // one pixel through one layer's compiled chain
+        NoiseProbe,    // one NoiseLatticeCache column lookup (misses add 2 Noise)
+        NoiseHit,      // a NoiseProbe served from the memo (tally only, no cost)
+        Count
+    };
+
+    constexpr size_t COUNTED_OP_COUNT = static_cast<size_t>(CountedOp::Count);
+
+    // Advance covers everything from PolarRenderer::prepareFrame() to the end
+    // of it (signals, simulations); Render the sampling that follows.
+    enum class OpStage : uint8_t {
+        Advance,
+        Render,
+        Count
+    };
+
+    struct OpCounts {
+        uint64_t ops[COUNTED_OP_COUNT]{};
+
+        uint64_t operator[](CountedOp op) const { return ops[static_cast<size_t>(op)]; }
+
+        uint64_t &operator[](CountedOp op) { return ops[static_cast<size_t>(op)]; }
+
+        // Average per frame, rounded to nearest.
+        OpCounts perFrame(uint32_t frames) const {
+            OpCounts result;
+            if (frames == 0) return result;
+            for (size_t i = 0; i < COUNTED_OP_COUNT; ++i) {
+                result.ops[i] = (ops[i] + frames / 2) / frames;
+            }
+            return result;
+        }
+    };
+
+    const char *countedOpName(CountedOp op);
+
+    /**
+     * @brief Global per-stage op tallies for the instrumented build.
+     *
+     * PolarRenderer::prepareFrame() calls beginFrame() on entry and
+     * beginRender() on exit, so every display path splits its counts the
+     * same way. Tallies accumulate until reset(); divide by frames() (or use
+     * OpCounts::perFrame) for per-frame figures.
+     */
+    class OpCounter {
+        inline static OpCounts stageCounts[static_cast<size_t>(OpStage::Count)]{};
+        inline static OpStage stage = OpStage::Render;
+        inline static uint32_t frameCount = 0;
+
+    public:
+        static void add(CountedOp op, uint32_t n = 1) {
+            stageCounts[static_cast<size_t>(stage)][op] += n;
+        }
+
+        static void beginFrame() {
+            ++frameCount;
+            stage = OpStage::Advance;
+        }
+
+        static void beginRender() { stage = OpStage::Render; }
+
+        static void reset() {
+            for (OpCounts &counts: stageCounts) counts = OpCounts{};
+            frameCount = 0;
+        }
+
+        static uint32_t frames() { return frameCount; }
+
+        static const OpCounts &counts(OpStage which) { return stageCounts[static_cast<size_t>(which)]; }
+    };
+}
+
+#if POLAR_SHADER_COUNT_OPS
+#define POLAR_SHADER_COUNT_OP(op) ::PolarShader::OpCounter::add(::PolarShader::CountedOp::op)
+#define POLAR_SHADER_COUNT_OPS_N(op, n) ::PolarShader::OpCounter::add(::PolarShader::CountedOp::op, (n))
+#define POLAR_SHADER_COUNT_OPS_BEGIN_FRAME() ::PolarShader::OpCounter::beginFrame()
+#define POLAR_SHADER_COUNT_OPS_BEGIN_RENDER() ::PolarShader::OpCounter::beginRender()
+#else
+#define POLAR_SHADER_COUNT_OP(op) do {} while (0)
+#define POLAR_SHADER_COUNT_OPS_N(op, n) do {} while (0)
+#define POLAR_SHADER_COUNT_OPS_BEGIN_FRAME() do {} while (0)
+#define POLAR_SHADER_COUNT_OPS_BEGIN_RENDER() do {} while (0)
+#endif
+
+#endif // POLAR_SHADER_OP_COUNTER_H
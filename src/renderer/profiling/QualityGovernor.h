@@ -0,0 +1,81 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef POLAR_SHADER_QUALITY_GOVERNOR_H
+#define POLAR_SHADER_QUALITY_GOVERNOR_H
+
+#include "renderer/pipeline/maths/units/Units.h"
+
+// Displays feed their measured render time to a QualityGovernor and scale
+// iteration-heavy patterns to hold the refresh rate. 0 always renders at
+// full quality.
+#ifndef POLAR_SHADER_QUALITY_GOVERNOR
+#define POLAR_SHADER_QUALITY_GOVERNOR 1
+#endif
+
+// Lowest quality the governor will settle on (u0x16 raw, 8192 = 1/8).
+#ifndef POLAR_SHADER_QUALITY_FLOOR
+#define POLAR_SHADER_QUALITY_FLOOR 8192u
+#endif
+
+namespace PolarShader {
+    /**
+     * @brief Frame-time feedback loop for PipelineContext::quality.
+     *
+     * Render times are smoothed with a 1/4 exponential average. Quality drops
+     * after LOWER_AFTER_FRAMES consecutive frames over the target, in
+     * proportion to the overrun since pattern cost is roughly linear in their
+     * iteration counts. It only climbs back, one RAISE_STEP at a time, after
+     * RAISE_AFTER_FRAMES consecutive frames under 3/4 of the target; frames in
+     * between hold the current level, so quality does not flicker around the
+     * budget. Each change rescales the average by the same ratio so the next
+     * decision is not made on frames rendered at the old level.
+     */
+    class QualityGovernor {
+    public:
+        static constexpr uint8_t LOWER_AFTER_FRAMES = 4;
+        static constexpr uint8_t RAISE_AFTER_FRAMES = 32;
+        static constexpr uint16_t RAISE_STEP = 4096;
+
+        explicit QualityGovernor(uint32_t targetMicros) : targetMicros(targetMicros) {}
+
+        // Feeds one frame's render time and returns the quality for the next.
+        u0x16 recordFrame(uint32_t renderMicros);
+
+        u0x16 quality() const { return u0x16(level); }
+
+        uint32_t averageMicros() const { return average; }
+
+        void setTargetMicros(uint32_t micros) { targetMicros = micros; }
+
+        void reset();
+
+    private:
+        uint32_t targetMicros;
+        uint32_t average{0};
+        uint16_t level{U0X16_MAX};
+        uint8_t overFrames{0};
+        uint8_t underFrames{0};
+
+        void setLevel(uint32_t next);
+    };
+}
+
+#endif // POLAR_SHADER_QUALITY_GOVERNOR_H
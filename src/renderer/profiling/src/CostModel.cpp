@@ -0,0 +1,139 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderer/profiling/CostModel.h"
+#include <cstdio>
+#include <cstring>
+
+namespace PolarShader {
+    // Cycle columns follow CountedOp: Mul64, Div64, Noise, Trig, PaletteLookup, LayerPixel,
+    // NoiseProbe, NoiseHit.
+    const BoardCostTable BOARD_COST_TABLES[] = {
+        // SAMD21 Cortex-M0+ @ 48 MHz: no 64-bit multiply or any divide in
+        // hardware; WS2812 output is bit-banged with interrupts off.
+        {"seeed_xiao", 48000000u, {24, 620, 380, 36, 110, 260, 40, 0}, 1, 30000, false},
+        // RP2040 dual Cortex-M0+ @ 133 MHz: SIO divider shortens 64-bit
+        // divides; PIO output overlaps the next render (FastLedDisplay).
+        {"seeed_xiao_rp2040", 133000000u, {22, 140, 360, 34, 105, 250, 38, 0}, 2, 30000, true},
+        // i.MX RT1062 Cortex-M7 @ 600 MHz: SmartMatrix refreshes by DMA, so
+        // show() is a buffer swap.
+        {"teensy41_matrix", 600000000u, {2, 40, 110, 10, 30, 60, 8, 0}, 1, 0, true},
+    };
+
+    const size_t BOARD_COST_TABLE_COUNT = sizeof(BOARD_COST_TABLES) / sizeof(BOARD_COST_TABLES[0]);
+
+    const char *countedOpName(CountedOp op) {
+        switch (op) {
+            case CountedOp::Mul64: return "mul64";
+            case CountedOp::Div64: return "div64";
+            case CountedOp::Noise: return "noise";
+            case CountedOp::Trig: return "trig";
+            case CountedOp::PaletteLookup: return "palette";
+            case CountedOp::LayerPixel: return "layer_pixel";
+            case CountedOp::NoiseProbe: return "noise_probe";
+            case CountedOp::NoiseHit: return "noise_hit";
+            default: return "?";
+        }
+    }
+
+    const BoardCostTable *findBoardCostTable(const char *name) {
+        if (!name) return nullptr;
+        for (size_t i = 0; i < BOARD_COST_TABLE_COUNT; ++i) {
+            if (strcmp(BOARD_COST_TABLES[i].name, name) == 0) return &BOARD_COST_TABLES[i];
+        }
+        return nullptr;
+    }
+
+    namespace {
+        uint64_t cyclesFor(const BoardCostTable &board, const OpCounts &counts) {
+            uint64_t cycles = 0;
+            for (size_t i = 0; i < COUNTED_OP_COUNT; ++i) {
+                cycles += counts.ops[i] * board.cyclesPerOp[i];
+            }
+            return cycles;
+        }
+
+        uint32_t cyclesToMicros(const BoardCostTable &board, uint64_t cycles) {
+            const uint32_t cyclesPerMicro = board.clockHz / 1000000u;
+            if (cyclesPerMicro == 0) return 0;
+            const uint64_t micros = (cycles + cyclesPerMicro / 2) / cyclesPerMicro;
+            return micros > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(micros);
+        }
+    }
+
+    FramePrediction predictFrame(
+        const BoardCostTable &board,
+        const OpCounts &advance,
+        const OpCounts &render,
+        uint16_t nbLeds
+    ) {
+        FramePrediction prediction;
+        prediction.advanceMicros = cyclesToMicros(board, cyclesFor(board, advance));
+        const uint8_t cores = board.renderCores ? board.renderCores : 1;
+        prediction.renderMicros = cyclesToMicros(board, (cyclesFor(board, render) + cores - 1) / cores);
+        prediction.showMicros = static_cast<uint32_t>(
+            (static_cast<uint64_t>(nbLeds) * board.showNanosPerLed + 500u) / 1000u);
+
+        const uint32_t compute = prediction.advanceMicros + prediction.renderMicros;
+        if (board.showOverlapsRender) {
+            prediction.frameMicros = compute > prediction.showMicros ? compute : prediction.showMicros;
+        } else {
+            prediction.frameMicros = compute + prediction.showMicros;
+        }
+        if (prediction.frameMicros == 0) prediction.frameMicros = 1;
+
+        const uint32_t fpsTenths = (10000000u + prediction.frameMicros / 2) / prediction.frameMicros;
+        prediction.fpsTenths = fpsTenths > UINT16_MAX ? UINT16_MAX : static_cast<uint16_t>(fpsTenths);
+        prediction.withinBudget = prediction.frameMicros <= POLAR_SHADER_FRAME_BUDGET_MS * 1000u;
+        return prediction;
+    }
+
+    size_t formatPredictionReport(
+        const OpCounts &advance,
+        const OpCounts &render,
+        uint16_t nbLeds,
+        char *buffer,
+        size_t capacity
+    ) {
+        if (capacity == 0) return 0;
+        buffer[0] = '\0';
+        size_t length = 0;
+        for (size_t i = 0; i < BOARD_COST_TABLE_COUNT && length + 1 < capacity; ++i) {
+            const BoardCostTable &board = BOARD_COST_TABLES[i];
+            const FramePrediction prediction = predictFrame(board, advance, render, nbLeds);
+            const int written = snprintf(
+                buffer + length,
+                capacity - length,
+                "%s %lu.%02lu ms %u.%u fps%s\n",
+                board.name,
+                static_cast<unsigned long>(prediction.frameMicros / 1000u),
+                static_cast<unsigned long>((prediction.frameMicros % 1000u) / 10u),
+                static_cast<unsigned>(prediction.fpsTenths / 10u),
+                static_cast<unsigned>(prediction.fpsTenths % 10u),
+                prediction.withinBudget ? "" : " over budget"
+            );
+            if (written < 0) break;
+            length += static_cast<size_t>(written) < capacity - length
+                          ? static_cast<size_t>(written)
+                          : capacity - length - 1;
+        }
+        return length;
+    }
+}
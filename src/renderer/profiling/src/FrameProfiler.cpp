@@ -0,0 +1,213 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderer/profiling/FrameProfiler.h"
+
+#if POLAR_SHADER_PROFILE
+
+#include <cstdio>
+#include <cstring>
+#if defined(ARDUINO) || defined(__EMSCRIPTEN__)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace PolarShader {
+    namespace {
+        constexpr size_t NAME_CAPACITY = 24;
+
+        struct Component {
+            char name[NAME_CAPACITY];
+            ProfileStage stage;
+            uint8_t step;
+            // Current frame, one slot per core.
+            uint32_t frameTicks[2];
+            // Window in progress.
+            uint32_t windowMin;
+            uint32_t windowMax;
+            uint64_t windowTotal;
+            // Last completed window.
+            ProfileStats published;
+        };
+
+        Component components[POLAR_SHADER_PROFILE_MAX_COMPONENTS];
+        volatile uint16_t registeredCount = 0;
+        uint16_t windowFrames = 0;
+
+        void clearWindow(Component &component) {
+            component.windowMin = UINT32_MAX;
+            component.windowMax = 0;
+            component.windowTotal = 0;
+        }
+
+        const char *stageLabel(ProfileStage stage) {
+            switch (stage) {
+                case ProfileStage::SceneAdvance: return "scene.advance";
+                case ProfileStage::LayerAdvance: return "layer.advance";
+                case ProfileStage::LayerSample: return "layer.sample";
+                case ProfileStage::Blend: return "scene.blend";
+                case ProfileStage::Show: return "show";
+                default: return "?";
+            }
+        }
+    }
+
+    uint32_t FrameProfiler::now() {
+#if defined(__IMXRT1062__)
+        return ARM_DWT_CYCCNT;
+#elif defined(ARDUINO) || defined(__EMSCRIPTEN__)
+        return micros();
+#else
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+#endif
+    }
+
+    const char *FrameProfiler::tickUnit() {
+#if defined(__IMXRT1062__)
+        return "cycles";
+#elif defined(ARDUINO) || defined(__EMSCRIPTEN__)
+        return "us";
+#else
+        return "ns";
+#endif
+    }
+
+    uint16_t FrameProfiler::componentId(ProfileStage stage, const char *name, uint8_t step) {
+        if (!name) name = "";
+        const uint16_t count = registeredCount;
+        for (uint16_t i = 0; i < count; ++i) {
+            const Component &component = components[i];
+            if (component.stage == stage && component.step == step &&
+                strncmp(component.name, name, NAME_CAPACITY - 1) == 0) {
+                return i;
+            }
+        }
+        if (count >= POLAR_SHADER_PROFILE_MAX_COMPONENTS) return NO_COMPONENT;
+
+        // Filled in before it is counted, so a core recording against
+        // existing ids never sees a half-written entry.
+        Component &component = components[count];
+        strncpy(component.name, name, NAME_CAPACITY - 1);
+        component.name[NAME_CAPACITY - 1] = '\0';
+        component.stage = stage;
+        component.step = step;
+        component.frameTicks[0] = 0;
+        component.frameTicks[1] = 0;
+        component.published = ProfileStats{};
+        clearWindow(component);
+        registeredCount = static_cast<uint16_t>(count + 1);
+        return count;
+    }
+
+    void FrameProfiler::record(uint16_t id, uint8_t coreIndex, uint32_t ticks) {
+        if (id >= registeredCount) return;
+        components[id].frameTicks[coreIndex == 0 ? 0 : 1] += ticks;
+    }
+
+    bool FrameProfiler::endFrame() {
+        const uint16_t count = registeredCount;
+        for (uint16_t i = 0; i < count; ++i) {
+            Component &component = components[i];
+            const uint32_t ticks = component.frameTicks[0] + component.frameTicks[1];
+            component.frameTicks[0] = 0;
+            component.frameTicks[1] = 0;
+            if (ticks < component.windowMin) component.windowMin = ticks;
+            if (ticks > component.windowMax) component.windowMax = ticks;
+            component.windowTotal += ticks;
+        }
+
+        if (++windowFrames < POLAR_SHADER_PROFILE_WINDOW_FRAMES) return false;
+
+        for (uint16_t i = 0; i < count; ++i) {
+            Component &component = components[i];
+            component.published = ProfileStats{
+                component.windowMin,
+                static_cast<uint32_t>(component.windowTotal / windowFrames),
+                component.windowMax
+            };
+            clearWindow(component);
+        }
+        windowFrames = 0;
+        return true;
+    }
+
+    void FrameProfiler::reset() {
+        const uint16_t count = registeredCount;
+        for (uint16_t i = 0; i < count; ++i) {
+            Component &component = components[i];
+            component.frameTicks[0] = 0;
+            component.frameTicks[1] = 0;
+            component.published = ProfileStats{};
+            clearWindow(component);
+        }
+        windowFrames = 0;
+    }
+
+    uint16_t FrameProfiler::componentCount() {
+        return registeredCount;
+    }
+
+    ProfileStats FrameProfiler::stats(uint16_t id) {
+        if (id >= registeredCount) return ProfileStats{};
+        return components[id].published;
+    }
+
+    size_t FrameProfiler::formatLine(uint16_t id, char *buffer, size_t capacity) {
+        if (capacity == 0) return 0;
+        buffer[0] = '\0';
+        if (id >= registeredCount) return 0;
+
+        const Component &component = components[id];
+        char step[6] = "";
+        if (component.step != NO_STEP) {
+            snprintf(step, sizeof(step), "#%u", static_cast<unsigned>(component.step));
+        }
+        const int written = snprintf(
+            buffer,
+            capacity,
+            "%s %s%s %lu %lu %lu %s\n",
+            stageLabel(component.stage),
+            component.name[0] ? component.name : "-",
+            step,
+            static_cast<unsigned long>(component.published.min),
+            static_cast<unsigned long>(component.published.mean),
+            static_cast<unsigned long>(component.published.max),
+            tickUnit()
+        );
+        if (written < 0) return 0;
+        return static_cast<size_t>(written) < capacity ? static_cast<size_t>(written) : capacity - 1;
+    }
+
+    size_t FrameProfiler::formatReport(char *buffer, size_t capacity) {
+        if (capacity == 0) return 0;
+        buffer[0] = '\0';
+        size_t length = 0;
+        const uint16_t count = registeredCount;
+        for (uint16_t i = 0; i < count && length + 1 < capacity; ++i) {
+            length += formatLine(i, buffer + length, capacity - length);
+        }
+        return length;
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderer/profiling/QualityGovernor.h"
+
+namespace PolarShader {
+    u0x16 QualityGovernor::recordFrame(uint32_t renderMicros) {
+        if (average == 0) {
+            average = renderMicros;
+        } else {
+            average = static_cast<uint32_t>(
+                (static_cast<uint64_t>(average) * 3u + renderMicros) >> 2
+            );
+        }
+        if (targetMicros == 0 || average == 0) return quality();
+
+        if (average > targetMicros) {
+            underFrames = 0;
+            if (++overFrames >= LOWER_AFTER_FRAMES) {
+                setLevel(static_cast<uint32_t>(
+                    static_cast<uint64_t>(level) * targetMicros / average
+                ));
+            }
+        } else if (average < targetMicros - (targetMicros >> 2)) {
+            overFrames = 0;
+            if (++underFrames >= RAISE_AFTER_FRAMES) {
+                setLevel(static_cast<uint32_t>(level) + RAISE_STEP);
+            }
+        } else {
+            overFrames = 0;
+            underFrames = 0;
+        }
+        return quality();
+    }
+
+    void QualityGovernor::reset() {
+        average = 0;
+        level = U0X16_MAX;
+        overFrames = 0;
+        underFrames = 0;
+    }
+
+    void QualityGovernor::setLevel(uint32_t next) {
+        if (next < POLAR_SHADER_QUALITY_FLOOR) next = POLAR_SHADER_QUALITY_FLOOR;
+        if (next > U0X16_MAX) next = U0X16_MAX;
+        overFrames = 0;
+        underFrames = 0;
+        if (next == level) return;
+        average = static_cast<uint32_t>(static_cast<uint64_t>(average) * next / level);
+        level = static_cast<uint16_t>(next);
+    }
+}
@@ -21,11 +21,40 @@
 #ifndef POLAR_SHADER_PIPELINE_SCENE_H
 #define POLAR_SHADER_PIPELINE_SCENE_H
 
-#include <array>
 #include <vector>
 #include <renderer/layer/Layer.h>
+#include "renderer/profiling/FrameProfiler.h"
+
+// Cores that sample the scene concurrently. Per-core sampler chains are only
+// compiled when this is above 1, i.e. on dual-core RP2040 builds.
+#ifndef POLAR_SHADER_SAMPLING_CORES
+#if defined(RP2040_ENABLED) && (!defined(POLAR_SHADER_RP2040_DUAL_CORE) || POLAR_SHADER_RP2040_DUAL_CORE)
+#define POLAR_SHADER_SAMPLING_CORES 2u
+#else
+#define POLAR_SHADER_SAMPLING_CORES 1u
+#endif
+#endif
 
 namespace PolarShader {
+    /**
+     * @brief The display's pixels, handed to Scene::prepareRender() once per
+     * frame. Spans later sampled from `points` are matched to their pixel
+     * index by address. When set, `cellPixel[y * width + x]` is the index of
+     * the pixel at raster cell (x, y), for layers rendered on a coarse grid;
+     * every cell must map to a pixel.
+     */
+    struct DisplayPixels {
+        const RenderPoint *points{nullptr};
+        const UV *cartesian{nullptr};
+        uint16_t count{0};
+        const uint16_t *cellPixel{nullptr};
+        uint16_t width{0};
+        uint16_t height{0};
+    };
+
+    // Composites `top` over `base` at `alpha` using the layer blend modes.
+    CRGB blendColours(CRGB base, CRGB top, u0x16 alpha, BlendMode mode);
+
     /**
      * @brief A Scene represents a collection of layers that are composited together.
      * 
@@ -36,29 +65,127 @@ namespace PolarShader {
      */
     class Scene {
         struct CompositedLayer {
-            std::unique_ptr<ColourMap> map;
+            // Shared by every core; samplers are read-only during render.
+            std::unique_ptr<ColourSpanMap> map;
+            // Second instance for core 1, only when two cores sample and the
+            // layer opts into per-core sampler state (Layer::needsPerCoreSampler).
+            std::unique_ptr<ColourSpanMap> core1Map;
             u0x16 alpha;
             BlendMode blendMode;
+            // Raster divisor (Layer::renderDivisor); above 1 the layer is
+            // read from `coarse`, a grid of every divisor-th row and column
+            // plus the last, refreshed each frame by renderCoarseLayers().
+            uint8_t divisor{1};
+            uint16_t coarseWidth{0};
+            uint16_t coarseHeight{0};
+            std::vector<CRGB> coarse;
+            // Frames between refreshes of each pixel (Layer::getFrameDivisor;
+            // 0 adapts frameDivisor to the measured change). Each frame
+            // refreshes the pixels whose index is framePhase modulo
+            // frameDivisor and reads the rest back from `history`.
+            uint8_t frameSetting{1};
+            uint8_t frameDivisor{1};
+            uint8_t framePhase{0};
+            // False until a frame has rendered every pixel into `history`.
+            bool historyValid{false};
+            mutable std::vector<CRGB> history;
+            // Per core: summed |ΔR|+|ΔG|+|ΔB| of refreshed pixels, and their count.
+            mutable uint32_t changeSum[2]{0, 0};
+            mutable uint32_t changePixels[2]{0, 0};
+#if POLAR_SHADER_PROFILE
+            uint16_t sampleProfileId{FrameProfiler::NO_COMPONENT};
+#endif
         };
 
         fl::vector<std::shared_ptr<Layer>> layers;
-        std::array<std::vector<CompositedLayer>, 2> compiledLayers;
+        std::vector<CompositedLayer> compiledLayers;
         TimeMillis durationMs;
+        bool hasCoarseLayers{false};
+        bool hasFrameSkipLayers{false};
+        // Pixels of the frame being rendered (DisplayPixels::points/count).
+        const RenderPoint *framePixels{nullptr};
+        uint16_t framePixelCount{0};
+
+        void renderCoarseLayers(const DisplayPixels &pixels);
+
+        static void adaptFrameDivisor(CompositedLayer &entry);
+
+        // Samples a frame-skipping layer, refreshing only this frame's share
+        // of the points. Returns false when the points are not a run of the
+        // frame's pixels, so the caller samples them directly.
+        bool sampleFrameSkip(
+            const CompositedLayer &entry,
+            const ColourSpanMap &map,
+            uint8_t coreIndex,
+            const RenderPoint *points,
+            const UV *cartesian,
+            CRGB *out,
+            uint16_t count
+        ) const;
+
+        // Bilinear read of a coarse layer at each point's raster cell.
+        // Returns false, leaving `out` unspecified, when a point has no raster
+        // cell on the grid the layer was rendered for.
+        static bool upsampleCoarse(
+            const CompositedLayer &entry,
+            const RenderPoint *points,
+            CRGB *out,
+            uint16_t count
+        );
+#if POLAR_SHADER_PROFILE
+        uint16_t blendProfileId{FrameProfiler::NO_COMPONENT};
+#endif
 
     public:
         Scene(fl::vector<std::shared_ptr<Layer>> layers, TimeMillis durationMs = UINT32_MAX);
 
         void advanceFrame(u0x16 progress, TimeMillis elapsedMs);
 
-        void compile(const RasterDisplayInfo &rasterDisplay = RasterDisplayInfo{});
+        // `samplingCores` above 1 gives per-core layers a second chain for core 1.
+        void compile(
+            const RasterDisplayInfo &rasterDisplay = RasterDisplayInfo{},
+            uint8_t samplingCores = POLAR_SHADER_SAMPLING_CORES
+        );
+
+        // Applies to every layer from the next advanceFrame().
+        void setQuality(u0x16 quality);
+
+        /**
+         * @brief Per-frame render setup: samples the grid nodes of layers
+         * rendered below full resolution and advances frame-skipping layers.
+         * Call once per frame after advanceFrame() and before any core
+         * samples; until then such layers are sampled per pixel.
+         */
+        void prepareRender(const DisplayPixels &pixels);
 
         CRGB sample(uint8_t coreIndex, const RenderPoint &point) const;
 
+        /**
+         * @brief Composites `count` contiguous points into `out`.
+         *
+         * `cartesian` is the optional precomputed Cartesian UV of each point
+         * (see ColourSpanMap); nullptr converts on the fly.
+         *
+         * Each layer's compiled chain runs once per batch of up to
+         * SPAN_CHUNK_SIZE points, and each blend mode is resolved once per
+         * batch rather than per pixel.
+         */
+        void sampleSpan(
+            uint8_t coreIndex,
+            const RenderPoint *points,
+            const UV *cartesian,
+            CRGB *out,
+            uint16_t count
+        ) const;
+
         CRGB sample(uint8_t coreIndex, u0x16 angle, u0x16 radius) const {
             return sample(coreIndex, RenderPoint{angle, radius, RasterPoint{}});
         }
 
         TimeMillis getDuration() const { return durationMs; }
+
+        // Bottom layer first.
+        const fl::vector<std::shared_ptr<Layer>> &getLayers() const { return layers; }
         
         bool isExpired(TimeMillis elapsedMs) const;
     };
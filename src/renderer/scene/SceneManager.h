@@ -25,7 +25,35 @@
 #include <memory>
 #include "renderer/pipeline/transforms/base/Layers.h"
 
+// How long before the current scene expires prefetchNextScene() may decode and
+// compile its successor. Both scenes are resident for at most this window, so
+// keep it short on RAM-constrained targets; 0 disables prefetching.
+#ifndef POLAR_SHADER_SCENE_PREFETCH_LEAD_MS
+#define POLAR_SHADER_SCENE_PREFETCH_LEAD_MS 5000u
+#endif
+
+// Default length of the transition between consecutive scenes. Both scenes are
+// resident and advanced for this window; 0 hard-cuts at expiry.
+#ifndef POLAR_SHADER_SCENE_TRANSITION_MS
+#define POLAR_SHADER_SCENE_TRANSITION_MS 0u
+#endif
+
 namespace PolarShader {
+    enum class SceneTransitionType : uint8_t {
+        Cut,
+        // Every pixel blends from the outgoing to the incoming scene.
+        Crossfade,
+        // The incoming scene grows outward from the centre along RenderPoint::radius.
+        RadialWipe,
+        // The incoming scene sweeps clockwise from angle 0 along RenderPoint::angle.
+        AngularSweep
+    };
+
+    struct SceneTransition {
+        SceneTransitionType type{SceneTransitionType::Crossfade};
+        TimeMillis durationMs{POLAR_SHADER_SCENE_TRANSITION_MS};
+    };
+
     /**
      * @brief Manages the high-level rendering lifecycle and scene transitions.
      * 
@@ -34,24 +62,76 @@ namespace PolarShader {
      * 2. Tracking the absolute time and calculating the time elapsed since the current scene started.
      * 3. Calculating the global normalized progress (0..1) of the current scene.
      * 4. Driving the animation of all layers within the active scene.
+     * 5. Prefetching the next scene during idle time so the swap at expiry
+     *    does not decode and compile inside a frame.
+     * 6. Compositing the outgoing and incoming scenes during a transition.
+     *    Wipes only sample both scenes inside the soft transition front;
+     *    pixels either side of it sample a single scene.
      */
     class SceneManager {
         std::unique_ptr<SceneProvider> provider;
         std::unique_ptr<Scene> currentScene;
+        // Next scene from the provider, already compiled, waiting for the
+        // current one to expire.
+        std::unique_ptr<Scene> pendingScene;
+        // Set once the provider has been asked for the current scene's
+        // successor, so an empty answer is not retried every idle slot.
+        bool prefetchAttempted{false};
+        // Previous scene, kept live while the transition to currentScene runs.
+        std::unique_ptr<Scene> outgoingScene;
         TimeMillis currentSceneStartTimeMs{0};
+        TimeMillis outgoingSceneStartTimeMs{0};
+        TimeMillis transitionStartTimeMs{0};
+        SceneTransition transition{};
+        // Progress of the running transition, refreshed by advanceFrame().
+        u0x16 transitionProgress{0};
         RasterDisplayInfo rasterDisplay{};
+        u0x16 quality{U0X16_MAX};
+
+        void sampleTransitionSpan(
+            uint8_t coreIndex,
+            const RenderPoint *points,
+            const UV *cartesian,
+            CRGB *out,
+            uint16_t count
+        ) const;
 
     public:
         explicit SceneManager(std::unique_ptr<SceneProvider> provider);
 
         void setRasterDisplayInfo(const RasterDisplayInfo &info);
 
+        // Render quality handed to every scene it advances, including ones
+        // swapped in later.
+        void setQuality(u0x16 quality) { this->quality = quality; }
+
+        u0x16 getQuality() const { return quality; }
+
+        // Applies to the next scene change; a running transition keeps its
+        // start time but picks up the new type and duration.
+        void setTransition(const SceneTransition &transition);
+
+        const SceneTransition &getTransition() const { return transition; }
+
+        bool isTransitioning() const { return outgoingScene != nullptr; }
+
         void advanceFrame(TimeMillis currentTimeMs);
 
+        // Scene::prepareRender for the current and outgoing scenes; call
+        // after advanceFrame().
+        void prepareRender(const DisplayPixels &pixels);
+
+        // Idle-time hook, called between frames on the core that owns the
+        // scene. When the current scene is within
+        // POLAR_SHADER_SCENE_PREFETCH_LEAD_MS of expiring, fetches and compiles
+        // its successor so advanceFrame() only has to swap it in. Returns true
+        // if it did any work.
+        bool prefetchNextScene(TimeMillis currentTimeMs);
+
         // Out-of-band override that bypasses the SceneProvider for the next frame.
-        // Drops the current scene immediately, takes ownership of `scene`, resets
-        // the elapsed-time counter to currentTimeMs, and calls scene->compile().
-        // No-op if scene == nullptr.
+        // Drops the current scene and any running transition immediately, takes
+        // ownership of `scene`, resets the elapsed-time counter to
+        // currentTimeMs, and calls scene->compile(). No-op if scene == nullptr.
         void replaceScene(std::unique_ptr<Scene> scene, TimeMillis currentTimeMs);
 
         // Drops the current scene but keeps the existing elapsed-time origin.
@@ -61,6 +141,15 @@ namespace PolarShader {
 
         CRGB sample(uint8_t coreIndex, const RenderPoint &point) const;
 
+        // Batched form of sample(); see Scene::sampleSpan.
+        void sampleSpan(
+            uint8_t coreIndex,
+            const RenderPoint *points,
+            const UV *cartesian,
+            CRGB *out,
+            uint16_t count
+        ) const;
+
         CRGB sample(uint8_t coreIndex, u0x16 angle, u0x16 radius) const {
             return sample(coreIndex, RenderPoint{angle, radius, RasterPoint{}});
         }
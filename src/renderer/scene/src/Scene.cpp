@@ -19,6 +19,7 @@
  */
 
 #include "renderer/scene/Scene.h"
+#include "renderer/profiling/OpCounter.h"
 #include <utility>
 
 namespace PolarShader {
@@ -28,17 +29,56 @@ namespace PolarShader {
     }
 
     void Scene::advanceFrame(u0x16 progress, TimeMillis elapsedMs) {
+        POLAR_SHADER_PROFILE_SCOPE(ProfileStage::SceneAdvance, "scene");
         for (auto &layer: layers) {
             layer->advanceFrame(progress, elapsedMs);
         }
     }
 
+    void Scene::setQuality(u0x16 quality) {
+        for (auto &layer: layers) {
+            if (layer) layer->setQuality(quality);
+        }
+    }
+
     bool Scene::isExpired(TimeMillis elapsedMs) const {
         if (durationMs == 0) return false;
         return elapsedMs >= durationMs;
     }
 
     namespace {
+        // Grid nodes along an axis of `size` cells: every divisor-th cell,
+        // with the last cell closing a shorter final interval.
+        uint16_t coarseNodeCount(uint16_t size, uint8_t divisor) {
+            if (size == 0) return 0;
+            return static_cast<uint16_t>((size - 1u + divisor - 1u) / divisor + 1u);
+        }
+
+        uint16_t coarseNodeCell(uint16_t node, uint16_t size, uint8_t divisor) {
+            const uint32_t cell = static_cast<uint32_t>(node) * divisor;
+            return static_cast<uint16_t>(cell < size ? cell : size - 1u);
+        }
+
+        // Lower grid node of `cell` and its 8-bit weight towards the next.
+        void coarseAxis(uint16_t cell, uint16_t size, uint8_t divisor, uint16_t &node, uint16_t &next, uint16_t &weight) {
+            node = static_cast<uint16_t>(cell / divisor);
+            const uint16_t lower = static_cast<uint16_t>(node * divisor);
+            const uint16_t upper = coarseNodeCell(static_cast<uint16_t>(node + 1u), size, divisor);
+            if (upper <= lower) {
+                next = node;
+                weight = 0;
+                return;
+            }
+            next = static_cast<uint16_t>(node + 1u);
+            weight = static_cast<uint16_t>((static_cast<uint32_t>(cell - lower) << 8) / (upper - lower));
+        }
+
+        uint8_t bilerpChannel(uint8_t c00, uint8_t c10, uint8_t c01, uint8_t c11, uint16_t wx, uint16_t wy) {
+            const uint32_t top = c00 * (256u - wx) + c10 * wx;
+            const uint32_t bottom = c01 * (256u - wx) + c11 * wx;
+            return static_cast<uint8_t>((top * (256u - wy) + bottom * wy) >> 16);
+        }
+
         CRGB blend(CRGB base, CRGB top, u0x16 alpha, BlendMode mode) {
             if (raw(alpha) == 0) return base;
 
@@ -78,41 +118,291 @@ namespace PolarShader {
                     return top;
             }
         }
+
+        template<BlendMode Mode>
+        void blendSpan(CRGB *base, const CRGB *top, uint16_t count, u0x16 alpha) {
+            for (uint16_t i = 0; i < count; ++i) {
+                base[i] = blend(base[i], top[i], alpha, Mode);
+            }
+        }
+
+        void blendSpan(CRGB *base, const CRGB *top, uint16_t count, u0x16 alpha, BlendMode mode) {
+            if (raw(alpha) == 0) return;
+
+            switch (mode) {
+                case BlendMode::Normal:
+                    blendSpan<BlendMode::Normal>(base, top, count, alpha);
+                    return;
+                case BlendMode::Add:
+                    blendSpan<BlendMode::Add>(base, top, count, alpha);
+                    return;
+                case BlendMode::Multiply:
+                    blendSpan<BlendMode::Multiply>(base, top, count, alpha);
+                    return;
+                case BlendMode::Screen:
+                    blendSpan<BlendMode::Screen>(base, top, count, alpha);
+                    return;
+                default:
+                    for (uint16_t i = 0; i < count; ++i) base[i] = top[i];
+                    return;
+            }
+        }
+    }
+
+    CRGB blendColours(CRGB base, CRGB top, u0x16 alpha, BlendMode mode) {
+        return blend(base, top, alpha, mode);
     }
 
-    void Scene::compile(const RasterDisplayInfo &rasterDisplay) {
+    void Scene::compile(const RasterDisplayInfo &rasterDisplay, uint8_t samplingCores) {
         for (const auto &layer: layers) {
             if (layer) layer->setRasterDisplayInfo(rasterDisplay);
         }
 
-        for (auto &coreLayers: compiledLayers) {
-            coreLayers.clear();
-            coreLayers.reserve(layers.size());
+        compiledLayers.clear();
+        compiledLayers.reserve(layers.size());
+        hasCoarseLayers = false;
+        hasFrameSkipLayers = false;
+        framePixels = nullptr;
+        framePixelCount = 0;
+        for (const auto &layer: layers) {
+            compiledLayers.push_back(CompositedLayer{
+                layer->compileSpan(),
+                samplingCores > 1 && layer->needsPerCoreSampler() ? layer->compileSpan() : nullptr,
+                layer->getAlpha(),
+                layer->getBlendMode()
+            });
+            compiledLayers.back().divisor = layer->renderDivisor(rasterDisplay);
+            if (compiledLayers.back().divisor > 1) {
+                hasCoarseLayers = true;
+            } else if (layer->getFrameDivisor() != 1) {
+                compiledLayers.back().frameSetting = layer->getFrameDivisor();
+                compiledLayers.back().frameDivisor = layer->getFrameDivisor() == 0 ? 1 : layer->getFrameDivisor();
+                hasFrameSkipLayers = true;
+            }
+#if POLAR_SHADER_PROFILE
+            compiledLayers.back().sampleProfileId =
+                    FrameProfiler::componentId(ProfileStage::LayerSample, layer->getName());
+#endif
         }
+#if POLAR_SHADER_PROFILE
+        blendProfileId = FrameProfiler::componentId(ProfileStage::Blend, "scene");
+#endif
+    }
+
+    void Scene::renderCoarseLayers(const DisplayPixels &pixels) {
+        if (!hasCoarseLayers || !pixels.points || !pixels.cellPixel) return;
 
-        for (auto &coreLayers: compiledLayers) {
-            for (const auto &layer: layers) {
-                coreLayers.push_back(CompositedLayer{
-                    layer->compile(),
-                    layer->getAlpha(),
-                    layer->getBlendMode()
-                });
+        RenderPoint points[SPAN_CHUNK_SIZE];
+        UV uvs[SPAN_CHUNK_SIZE];
+        for (auto &entry: compiledLayers) {
+            if (entry.divisor <= 1 || !entry.map) continue;
+            POLAR_SHADER_PROFILE_SCOPE(entry.sampleProfileId, 0);
+            entry.coarseWidth = coarseNodeCount(pixels.width, entry.divisor);
+            entry.coarseHeight = coarseNodeCount(pixels.height, entry.divisor);
+            const uint32_t nodes = static_cast<uint32_t>(entry.coarseWidth) * entry.coarseHeight;
+            entry.coarse.resize(nodes);
+
+            uint32_t node = 0;
+            while (node < nodes) {
+                uint16_t n = 0;
+                for (uint32_t k = node; k < nodes && n < SPAN_CHUNK_SIZE; ++k, ++n) {
+                    const uint16_t x = coarseNodeCell(static_cast<uint16_t>(k % entry.coarseWidth), pixels.width, entry.divisor);
+                    const uint16_t y = coarseNodeCell(static_cast<uint16_t>(k / entry.coarseWidth), pixels.height, entry.divisor);
+                    const uint16_t pixel = pixels.cellPixel[static_cast<uint32_t>(y) * pixels.width + x];
+                    points[n] = pixels.points[pixel];
+                    if (pixels.cartesian) uvs[n] = pixels.cartesian[pixel];
+                }
+                POLAR_SHADER_COUNT_OPS_N(LayerPixel, n);
+                (*entry.map)(points, pixels.cartesian ? uvs : nullptr, entry.coarse.data() + node, n);
+                node += n;
             }
         }
     }
 
-    CRGB Scene::sample(uint8_t coreIndex, const RenderPoint &point) const {
-        if (layers.empty()) {
-            return CRGB::Black;
+    void Scene::prepareRender(const DisplayPixels &pixels) {
+        renderCoarseLayers(pixels);
+        if (!hasFrameSkipLayers) return;
+
+        const bool sameDisplay = pixels.points == framePixels && pixels.count == framePixelCount;
+        framePixels = pixels.points;
+        framePixelCount = pixels.count;
+        for (auto &entry: compiledLayers) {
+            if (entry.frameSetting == 1) continue;
+            if (!sameDisplay || entry.history.size() != pixels.count) {
+                // This frame renders every pixel and fills the history.
+                entry.history.assign(pixels.count, CRGB::Black);
+                entry.historyValid = false;
+            } else if (!entry.historyValid) {
+                entry.historyValid = true;
+                entry.framePhase = 0;
+                entry.changeSum[0] = entry.changeSum[1] = 0;
+                entry.changePixels[0] = entry.changePixels[1] = 0;
+            } else {
+                entry.framePhase = static_cast<uint8_t>((entry.framePhase + 1u) % entry.frameDivisor);
+                if (entry.framePhase == 0 && entry.frameSetting == 0) adaptFrameDivisor(entry);
+            }
+        }
+    }
+
+    void Scene::adaptFrameDivisor(CompositedLayer &entry) {
+        const uint32_t pixels = entry.changePixels[0] + entry.changePixels[1];
+        if (pixels != 0) {
+            // Mean change of a pixel over frameDivisor frames, i.e. how far
+            // a skipped pixel drifted before its refresh.
+            const uint32_t drift = (entry.changeSum[0] + entry.changeSum[1]) / pixels;
+            const uint32_t divisor = entry.frameDivisor;
+            if (drift > POLAR_SHADER_FRAME_SKIP_TOLERANCE) {
+                if (divisor > 1) --entry.frameDivisor;
+            } else if (divisor < POLAR_SHADER_FRAME_SKIP_MAX &&
+                       drift * (divisor + 1u) * 2u <= POLAR_SHADER_FRAME_SKIP_TOLERANCE * divisor) {
+                // One more frame of skipping would still drift under half the tolerance.
+                ++entry.frameDivisor;
+            }
+        }
+        entry.changeSum[0] = entry.changeSum[1] = 0;
+        entry.changePixels[0] = entry.changePixels[1] = 0;
+    }
+
+    bool Scene::sampleFrameSkip(
+        const CompositedLayer &entry,
+        const ColourSpanMap &map,
+        uint8_t coreIndex,
+        const RenderPoint *points,
+        const UV *cartesian,
+        CRGB *out,
+        uint16_t count
+    ) const {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(framePixels);
+        const uintptr_t at = reinterpret_cast<uintptr_t>(points);
+        if (!framePixels || at < base) return false;
+        const uintptr_t first = (at - base) / sizeof(RenderPoint);
+        if (first + count > framePixelCount || entry.history.size() != framePixelCount) return false;
+        CRGB *history = entry.history.data() + first;
+
+        if (!entry.historyValid) {
+            POLAR_SHADER_COUNT_OPS_N(LayerPixel, count);
+            map(points, cartesian, out, count);
+            for (uint16_t i = 0; i < count; ++i) history[i] = out[i];
+            return true;
+        }
+
+        RenderPoint gathered[SPAN_CHUNK_SIZE];
+        UV uvs[SPAN_CHUNK_SIZE];
+        CRGB fresh[SPAN_CHUNK_SIZE];
+        uint8_t indices[SPAN_CHUNK_SIZE];
+        uint16_t n = 0;
+        uint8_t slot = static_cast<uint8_t>(first % entry.frameDivisor);
+        for (uint16_t i = 0; i < count; ++i) {
+            if (slot == entry.framePhase) {
+                gathered[n] = points[i];
+                if (cartesian) uvs[n] = cartesian[i];
+                indices[n++] = static_cast<uint8_t>(i);
+            } else {
+                out[i] = history[i];
+            }
+            if (++slot == entry.frameDivisor) slot = 0;
         }
+        if (n == 0) return true;
 
-        const auto &coreLayers = compiledLayers[coreIndex == 0 ? 0 : 1];
-        CRGB result = CRGB::Black;
-        for (const auto &entry: coreLayers) {
-            if (!entry.map) continue;
-            CRGB layerColor = (*entry.map)(point);
-            result = blend(result, layerColor, entry.alpha, entry.blendMode);
+        POLAR_SHADER_COUNT_OPS_N(LayerPixel, n);
+        map(gathered, cartesian ? uvs : nullptr, fresh, n);
+        uint32_t change = 0;
+        for (uint16_t k = 0; k < n; ++k) {
+            CRGB &previous = history[indices[k]];
+            change += static_cast<uint32_t>(abs(fresh[k].r - previous.r) + abs(fresh[k].g - previous.g) + abs(fresh[k].b - previous.b));
+            previous = fresh[k];
+            out[indices[k]] = fresh[k];
         }
+        const uint8_t core = coreIndex == 0 ? 0 : 1;
+        entry.changeSum[core] += change;
+        entry.changePixels[core] += n;
+        return true;
+    }
+
+    CRGB Scene::sample(uint8_t coreIndex, const RenderPoint &point) const {
+        CRGB result;
+        sampleSpan(coreIndex, &point, nullptr, &result, 1);
         return result;
     }
+
+    bool Scene::upsampleCoarse(
+        const CompositedLayer &entry,
+        const RenderPoint *points,
+        CRGB *out,
+        uint16_t count
+    ) {
+        for (uint16_t i = 0; i < count; ++i) {
+            const RasterPoint &raster = points[i].raster;
+            if (!raster.valid) return false;
+        }
+        for (uint16_t i = 0; i < count; ++i) {
+            const RasterPoint &raster = points[i].raster;
+            uint16_t x0, x1, wx, y0, y1, wy;
+            coarseAxis(raster.x, raster.width, entry.divisor, x0, x1, wx);
+            coarseAxis(raster.y, raster.height, entry.divisor, y0, y1, wy);
+            if (x1 >= entry.coarseWidth || y1 >= entry.coarseHeight) return false;
+            const CRGB *row0 = entry.coarse.data() + static_cast<uint32_t>(y0) * entry.coarseWidth;
+            const CRGB *row1 = entry.coarse.data() + static_cast<uint32_t>(y1) * entry.coarseWidth;
+            const CRGB &c00 = row0[x0];
+            const CRGB &c10 = row0[x1];
+            const CRGB &c01 = row1[x0];
+            const CRGB &c11 = row1[x1];
+            out[i] = CRGB(
+                bilerpChannel(c00.r, c10.r, c01.r, c11.r, wx, wy),
+                bilerpChannel(c00.g, c10.g, c01.g, c11.g, wx, wy),
+                bilerpChannel(c00.b, c10.b, c01.b, c11.b, wx, wy)
+            );
+        }
+        return true;
+    }
+
+    void Scene::sampleSpan(
+        uint8_t coreIndex,
+        const RenderPoint *points,
+        const UV *cartesian,
+        CRGB *out,
+        uint16_t count
+    ) const {
+        for (uint16_t i = 0; i < count; ++i) {
+            out[i] = CRGB::Black;
+        }
+        if (layers.empty()) return;
+
+        CRGB layerColours[SPAN_CHUNK_SIZE];
+        for (uint16_t start = 0; start < count; start += SPAN_CHUNK_SIZE) {
+            const uint16_t remaining = static_cast<uint16_t>(count - start);
+            const uint16_t n = remaining < SPAN_CHUNK_SIZE ? remaining : SPAN_CHUNK_SIZE;
+            for (const auto &entry: compiledLayers) {
+                const ColourSpanMap *map = coreIndex != 0 && entry.core1Map ? entry.core1Map.get() : entry.map.get();
+                if (!map) continue;
+                if (!entry.coarse.empty() && upsampleCoarse(entry, points + start, layerColours, n)) {
+                    POLAR_SHADER_PROFILE_SCOPE(blendProfileId, coreIndex);
+                    blendSpan(out + start, layerColours, n, entry.alpha, entry.blendMode);
+                    continue;
+                }
+                if (entry.frameSetting != 1) {
+                    bool reused;
+                    {
+                        POLAR_SHADER_PROFILE_SCOPE(entry.sampleProfileId, coreIndex);
+                        reused = sampleFrameSkip(
+                            entry, *map, coreIndex, points + start,
+                            cartesian ? cartesian + start : nullptr, layerColours, n
+                        );
+                    }
+                    if (reused) {
+                        POLAR_SHADER_PROFILE_SCOPE(blendProfileId, coreIndex);
+                        blendSpan(out + start, layerColours, n, entry.alpha, entry.blendMode);
+                        continue;
+                    }
+                }
+                POLAR_SHADER_COUNT_OPS_N(LayerPixel, n);
+                {
+                    POLAR_SHADER_PROFILE_SCOPE(entry.sampleProfileId, coreIndex);
+                    (*map)(points + start, cartesian ? cartesian + start : nullptr, layerColours, n);
+                }
+                POLAR_SHADER_PROFILE_SCOPE(blendProfileId, coreIndex);
+                blendSpan(out + start, layerColours, n, entry.alpha, entry.blendMode);
+            }
+        }
+    }
 }
@@ -21,37 +21,139 @@
 #include "renderer/scene/SceneManager.h"
 
 namespace PolarShader {
+    namespace {
+        // Width of the soft edge of a wipe front, as a shift of the full
+        // 0..1 range: 1/8 of the radius or of a turn.
+        constexpr uint8_t TRANSITION_FEATHER_SHIFT = 3;
+        constexpr uint32_t TRANSITION_FEATHER = 0x10000u >> TRANSITION_FEATHER_SHIFT;
+
+        u0x16 progressOf(TimeMillis elapsed, TimeMillis duration) {
+            if (duration == 0) return u0x16(0xFFFFu);
+            uint64_t p = (static_cast<uint64_t>(elapsed) * 0xFFFFu) / duration;
+            if (p > 0xFFFFu) p = 0xFFFFu;
+            return u0x16(static_cast<uint16_t>(p));
+        }
+
+        void advanceScene(Scene &scene, TimeMillis elapsed, u0x16 quality) {
+            scene.setQuality(quality);
+            scene.advanceFrame(progressOf(elapsed, scene.getDuration()), elapsed);
+        }
+
+        // Weight of the incoming scene at `coord` (radius or angle) when the
+        // front has travelled `progress` of the way. The front starts one
+        // feather width before 0 and ends at 1, so both ends are clean.
+        uint16_t wipeWeight(u0x16 progress, u0x16 coord) {
+            const int32_t edge = static_cast<int32_t>(
+                (static_cast<uint32_t>(raw(progress)) * (0x10000u + TRANSITION_FEATHER)) >> 16
+            );
+            const int32_t reach = edge - static_cast<int32_t>(raw(coord));
+            if (reach <= 0) return 0;
+            if (reach >= static_cast<int32_t>(TRANSITION_FEATHER)) return 0xFFFFu;
+            return static_cast<uint16_t>(reach << TRANSITION_FEATHER_SHIFT);
+        }
+
+        // Samples the scattered points `indices` of a span into `colours`.
+        void sampleGathered(
+            const Scene &scene,
+            uint8_t coreIndex,
+            const RenderPoint *points,
+            const UV *cartesian,
+            const uint8_t *indices,
+            uint16_t count,
+            CRGB *colours
+        ) {
+            RenderPoint gatheredPoints[SPAN_CHUNK_SIZE];
+            UV gatheredCartesian[SPAN_CHUNK_SIZE];
+            for (uint16_t i = 0; i < count; ++i) {
+                gatheredPoints[i] = points[indices[i]];
+                if (cartesian) gatheredCartesian[i] = cartesian[indices[i]];
+            }
+            scene.sampleSpan(
+                coreIndex,
+                gatheredPoints,
+                cartesian ? gatheredCartesian : nullptr,
+                colours,
+                count
+            );
+        }
+    }
+
     SceneManager::SceneManager(std::unique_ptr<SceneProvider> provider)
         : provider(std::move(provider)) {
     }
 
     void SceneManager::setRasterDisplayInfo(const RasterDisplayInfo &info) {
         rasterDisplay = info;
+        // A prefetched scene was compiled against the old geometry.
+        if (pendingScene) pendingScene->compile(rasterDisplay);
+        if (outgoingScene) outgoingScene->compile(rasterDisplay);
+    }
+
+    void SceneManager::setTransition(const SceneTransition &transition) {
+        this->transition = transition;
     }
 
     void SceneManager::advanceFrame(TimeMillis currentTimeMs) {
         if (!currentScene || currentScene->isExpired(currentTimeMs - currentSceneStartTimeMs)) {
-            currentScene = provider->nextScene();
+            std::unique_ptr<Scene> nextScene;
+            if (pendingScene) {
+                nextScene = std::move(pendingScene);
+            } else {
+                nextScene = provider->nextScene();
+                if (nextScene) nextScene->compile(rasterDisplay);
+            }
+            prefetchAttempted = false;
+
+            const bool transitions = transition.type != SceneTransitionType::Cut && transition.durationMs != 0;
+            if (nextScene && currentScene && transitions) {
+                // A transition still running is cut short by the new one.
+                outgoingScene = std::move(currentScene);
+                outgoingSceneStartTimeMs = currentSceneStartTimeMs;
+                transitionStartTimeMs = currentTimeMs;
+            } else {
+                outgoingScene.reset();
+            }
+
+            currentScene = std::move(nextScene);
             if (currentScene) {
                 currentSceneStartTimeMs = currentTimeMs;
-                currentScene->compile(rasterDisplay);
             }
         }
 
-        if (currentScene) {
-            TimeMillis elapsed = currentTimeMs - currentSceneStartTimeMs;
-            TimeMillis duration = currentScene->getDuration();
-            u0x16 progress;
-
-            if (duration == 0) {
-                progress = u0x16(0xFFFFu);
+        if (outgoingScene) {
+            const TimeMillis transitionElapsed = currentTimeMs - transitionStartTimeMs;
+            if (transitionElapsed >= transition.durationMs) {
+                outgoingScene.reset();
             } else {
-                uint64_t p = (static_cast<uint64_t>(elapsed) * 0xFFFFu) / duration;
-                if (p > 0xFFFFu) p = 0xFFFFu;
-                progress = u0x16(static_cast<uint16_t>(p));
+                transitionProgress = progressOf(transitionElapsed, transition.durationMs);
+                advanceScene(*outgoingScene, currentTimeMs - outgoingSceneStartTimeMs, quality);
             }
-            currentScene->advanceFrame(progress, elapsed);
         }
+
+        if (currentScene) {
+            advanceScene(*currentScene, currentTimeMs - currentSceneStartTimeMs, quality);
+        }
+    }
+
+    void SceneManager::prepareRender(const DisplayPixels &pixels) {
+        if (outgoingScene) outgoingScene->prepareRender(pixels);
+        if (currentScene) currentScene->prepareRender(pixels);
+    }
+
+    bool SceneManager::prefetchNextScene(TimeMillis currentTimeMs) {
+        if (POLAR_SHADER_SCENE_PREFETCH_LEAD_MS == 0) return false;
+        if (!currentScene || pendingScene || prefetchAttempted) return false;
+
+        const TimeMillis duration = currentScene->getDuration();
+        if (duration == 0 || duration == UINT32_MAX) return false;
+
+        const TimeMillis elapsed = currentTimeMs - currentSceneStartTimeMs;
+        if (elapsed < duration && duration - elapsed > POLAR_SHADER_SCENE_PREFETCH_LEAD_MS) return false;
+
+        prefetchAttempted = true;
+        pendingScene = provider->nextScene();
+        if (pendingScene) pendingScene->compile(rasterDisplay);
+        return true;
     }
 
     void SceneManager::replaceScene(std::unique_ptr<Scene> scene, TimeMillis currentTimeMs) {
@@ -59,8 +161,10 @@ namespace PolarShader {
             return;
         }
         currentScene = std::move(scene);
+        outgoingScene.reset();
         currentSceneStartTimeMs = currentTimeMs;
         currentScene->compile(rasterDisplay);
+        if (!pendingScene) prefetchAttempted = false;
     }
 
     void SceneManager::replaceScenePreservingElapsed(std::unique_ptr<Scene> scene) {
@@ -69,12 +173,115 @@ namespace PolarShader {
         }
         currentScene = std::move(scene);
         currentScene->compile(rasterDisplay);
+        if (!pendingScene) prefetchAttempted = false;
     }
 
     CRGB SceneManager::sample(uint8_t coreIndex, const RenderPoint &point) const {
         if (!currentScene) {
             return CRGB::Black;
         }
+        if (outgoingScene) {
+            CRGB result;
+            sampleTransitionSpan(coreIndex, &point, nullptr, &result, 1);
+            return result;
+        }
         return currentScene->sample(coreIndex, point);
     }
+
+    void SceneManager::sampleSpan(
+        uint8_t coreIndex,
+        const RenderPoint *points,
+        const UV *cartesian,
+        CRGB *out,
+        uint16_t count
+    ) const {
+        if (!currentScene) {
+            for (uint16_t i = 0; i < count; ++i) {
+                out[i] = CRGB::Black;
+            }
+            return;
+        }
+        if (outgoingScene) {
+            sampleTransitionSpan(coreIndex, points, cartesian, out, count);
+            return;
+        }
+        currentScene->sampleSpan(coreIndex, points, cartesian, out, count);
+    }
+
+    void SceneManager::sampleTransitionSpan(
+        uint8_t coreIndex,
+        const RenderPoint *points,
+        const UV *cartesian,
+        CRGB *out,
+        uint16_t count
+    ) const {
+        CRGB incoming[SPAN_CHUNK_SIZE];
+
+        if (transition.type == SceneTransitionType::Crossfade) {
+            // The front covers every pixel, so both scenes are sampled throughout.
+            outgoingScene->sampleSpan(coreIndex, points, cartesian, out, count);
+            for (uint16_t start = 0; start < count; start += SPAN_CHUNK_SIZE) {
+                const uint16_t remaining = static_cast<uint16_t>(count - start);
+                const uint16_t n = remaining < SPAN_CHUNK_SIZE ? remaining : SPAN_CHUNK_SIZE;
+                currentScene->sampleSpan(
+                    coreIndex, points + start, cartesian ? cartesian + start : nullptr, incoming, n
+                );
+                for (uint16_t i = 0; i < n; ++i) {
+                    out[start + i] = blendColours(out[start + i], incoming[i], transitionProgress, BlendMode::Normal);
+                }
+            }
+            return;
+        }
+
+        const bool radial = transition.type == SceneTransitionType::RadialWipe;
+        uint16_t weights[SPAN_CHUNK_SIZE];
+        uint8_t outgoingIndices[SPAN_CHUNK_SIZE];
+        uint8_t incomingIndices[SPAN_CHUNK_SIZE];
+        CRGB outgoing[SPAN_CHUNK_SIZE];
+
+        for (uint16_t start = 0; start < count; start += SPAN_CHUNK_SIZE) {
+            const uint16_t remaining = static_cast<uint16_t>(count - start);
+            const uint16_t n = remaining < SPAN_CHUNK_SIZE ? remaining : SPAN_CHUNK_SIZE;
+            const RenderPoint *chunkPoints = points + start;
+            const UV *chunkCartesian = cartesian ? cartesian + start : nullptr;
+            CRGB *chunkOut = out + start;
+
+            uint16_t outgoingCount = 0;
+            uint16_t incomingCount = 0;
+            for (uint16_t i = 0; i < n; ++i) {
+                const RenderPoint &point = chunkPoints[i];
+                const uint16_t weight = wipeWeight(transitionProgress, radial ? point.radius : point.angle);
+                weights[i] = weight;
+                if (weight != 0xFFFFu) outgoingIndices[outgoingCount++] = static_cast<uint8_t>(i);
+                if (weight != 0) incomingIndices[incomingCount++] = static_cast<uint8_t>(i);
+            }
+
+            // Whole chunk on one side of the front: a single contiguous span.
+            if (incomingCount == 0) {
+                outgoingScene->sampleSpan(coreIndex, chunkPoints, chunkCartesian, chunkOut, n);
+                continue;
+            }
+            if (outgoingCount == 0) {
+                currentScene->sampleSpan(coreIndex, chunkPoints, chunkCartesian, chunkOut, n);
+                continue;
+            }
+
+            sampleGathered(
+                *outgoingScene, coreIndex, chunkPoints, chunkCartesian, outgoingIndices, outgoingCount, outgoing
+            );
+            for (uint16_t i = 0; i < outgoingCount; ++i) {
+                chunkOut[outgoingIndices[i]] = outgoing[i];
+            }
+
+            sampleGathered(
+                *currentScene, coreIndex, chunkPoints, chunkCartesian, incomingIndices, incomingCount, incoming
+            );
+            for (uint16_t i = 0; i < incomingCount; ++i) {
+                const uint8_t index = incomingIndices[i];
+                chunkOut[index] = weights[index] == 0xFFFFu
+                                      ? incoming[i]
+                                      : blendColours(chunkOut[index], incoming[i], u0x16(weights[index]), BlendMode::Normal);
+            }
+        }
+    }
 }
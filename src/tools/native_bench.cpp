@@ -0,0 +1,602 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Native render benchmark (native desktop tool, own main()).
+ *
+ * Renders every case below through the REAL PolarRenderer frame path on every
+ * display (.pds) in a directory and times it:
+ *   pattern    each factory in Patterns.h (defaults), alone in a layer
+ *   transform  each transform in transforms/ over a plain noisePattern()
+ *   preset     each preset in Presets.h
+ *
+ * Output is CSV on stdout, one row per (case, display):
+ *   kind,name,display,leds,frames,ns_per_frame,ns_per_pixel
+ * Progress and errors go to stderr, so `> bench.csv` captures only data.
+ *
+ * --predict appends op counts from the instrumented maths helpers
+ * (POLAR_SHADER_COUNT_OPS, see OpCounter.h): <op>_px per pixel for the render
+ * stage, <op>_frame per frame for the advance stage, then <board>_ms, the
+ * CostModel frame time for each BOARD_COST_TABLES entry, then noise_hit_pct,
+ * the share of noise lattice lookups served by NoiseLatticeCache (empty for
+ * cases that sample no noise).
+ * --kernels instead times solver cores in isolation, old against new, one
+ * CSV row per (kernel, grid):
+ *   kind,name,grid,cells,steps,ns_per_step,ns_per_cell
+ * gray_scott_per_cell is the previous per-cell wrapped Gray-Scott loop, kept
+ * here as the baseline for gray_scott_rows (GrayScott.h); advect_fn_ptr and
+ * lanes_per_cell are the previous GridUtils advection loops, baselines for
+ * advect_inline and lanes_wrapped.
+ * Native timings are not device timings; compare rows across commits on the
+ * same machine to catch regressions, not against a frame budget.
+ *
+ * Compiled ONLY by [env:native_bench]; every other env excludes
+ * tools/native_bench.cpp so no second main() is ever linked.
+ * Run:
+ *   pio run -e native_bench && \
+ *     .pio/build/native_bench/program --displays displays --frames 200 > bench.csv
+ */
+
+#include "native/Arduino.h"
+#include "native/FastLED.h"
+
+#include "display/DisplaySpecCodec.h"
+#include "display/LoadedDisplaySpec.h"
+#include "renderer/PolarRenderer.h"
+#include "renderer/layer/Layer.h"
+#include "renderer/pipeline/patterns/GrayScott.h"
+#include "renderer/pipeline/patterns/GridUtils.h"
+#include "renderer/pipeline/patterns/Patterns.h"
+#include "renderer/pipeline/presets/Presets.h"
+#include "renderer/pipeline/transforms/FlowFieldTransform.h"
+#include "renderer/pipeline/transforms/KaleidoscopeTransform.h"
+#include "renderer/pipeline/transforms/PaletteTransform.h"
+#include "renderer/pipeline/transforms/RadialKaleidoscopeTransform.h"
+#include "renderer/pipeline/transforms/RotationTransform.h"
+#include "renderer/pipeline/transforms/TilingTransform.h"
+#include "renderer/pipeline/transforms/TranslationTransform.h"
+#include "renderer/pipeline/transforms/VortexTransform.h"
+#include "renderer/pipeline/transforms/ZoomTransform.h"
+#include "renderer/profiling/CostModel.h"
+#include "renderer/scene/Scene.h"
+#include "renderer/scene/SceneProvider.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace PolarShader;
+
+namespace {
+
+// Simulated frame interval handed to the renderer (60 fps).
+constexpr TimeMillis FRAME_INTERVAL_MS = 16;
+
+struct BenchCase {
+    const char *kind;
+    const char *name;
+    std::function<LayerBuilder()> builder;
+};
+
+struct Args {
+    std::string displaysDir = "displays";
+    uint32_t frames = 200;
+    uint32_t warmupFrames = 16;
+    std::string filter;
+    bool predict = false;
+    bool kernels = false;
+};
+
+struct CaseResult {
+    uint64_t totalNs = 0;
+    // Per-frame averages over the measured frames.
+    OpCounts advanceOps;
+    OpCounts renderOps;
+};
+
+bool readFile(const std::string &path, std::vector<uint8_t> &out) {
+    std::ifstream f(path, std::ios::binary | std::ios::ate);
+    if (!f) return false;
+    const std::streamsize size = f.tellg();
+    if (size < 0) return false;
+    f.seekg(0, std::ios::beg);
+    out.resize(static_cast<size_t>(size));
+    return static_cast<bool>(f.read(reinterpret_cast<char *>(out.data()), size));
+}
+
+LayerBuilder patternCase(std::unique_ptr<UVPattern> pattern, const char *name) {
+    return LayerBuilder(std::move(pattern), Rainbow_gp, name);
+}
+
+template<typename T>
+LayerBuilder transformCase(T transform, const char *name) {
+    return LayerBuilder(noisePattern(), Rainbow_gp, name).addTransform(std::move(transform));
+}
+
+std::vector<BenchCase> buildCases() {
+    std::vector<BenchCase> cases;
+    const auto pattern = [&cases](const char *name, std::function<std::unique_ptr<UVPattern>()> make) {
+        cases.push_back({"pattern", name, [name, make]() { return patternCase(make(), name); }});
+    };
+    const auto transform = [&cases](const char *name, std::function<LayerBuilder()> make) {
+        cases.push_back({"transform", name, std::move(make)});
+    };
+    const auto preset = [&cases](const char *name, LayerBuilder (*make)(const CRGBPalette16 &)) {
+        cases.push_back({"preset", name, [make]() { return make(Rainbow_gp); }});
+    };
+
+    // Patterns.h factories, default arguments unless one is required.
+    pattern("worley", [] { return worleyPattern(); });
+    pattern("voronoi", [] { return voronoiPattern(); });
+    pattern("noise", [] { return noisePattern(); });
+    pattern("noise_loop", [] { return noiseLoopPattern(cRandom(), 10000); });
+    pattern("fbm_noise", [] { return fbmNoisePattern(); });
+    pattern("turbulence_noise", [] { return turbulenceNoisePattern(); });
+    pattern("ridged_noise", [] { return ridgedNoisePattern(); });
+    pattern("tiling", [] { return tilingPattern(); });
+    pattern("reaction_diffusion", [] { return reactionDiffusionPattern(); });
+    pattern("conway", [] { return conwayPattern(); });
+    pattern("cyclic_ca", [] { return cyclicCAPattern(); });
+    pattern("brians_brain", [] { return briansBrainPattern(); });
+    pattern("life_variant", [] { return lifeVariantPattern(); });
+    pattern("elementary_ca", [] { return elementaryCAPattern(); });
+    pattern("matrix_rain", [] { return matrixRainPattern(); });
+    pattern("ripple", [] { return ripplePattern(); });
+    pattern("forest_fire", [] { return forestFirePattern(); });
+    pattern("wire_world", [] { return wireWorldPattern(); });
+    pattern("langton_ant", [] { return langtonAntPattern(); });
+    pattern("raster_reaction_diffusion", [] { return rasterReactionDiffusionPattern(); });
+    pattern("xor", [] { return xorPattern(); });
+    pattern("flow_field", [] { return flowFieldPattern(); });
+    pattern("transport", [] { return transportPattern(); });
+    pattern("spiral", [] { return spiralPattern(); });
+    pattern("annuli", [] { return annuliPattern(); });
+    pattern("flurry", [] { return flurryPattern(); });
+    pattern("palette_glow", [] { return paletteGlowPattern(); });
+    pattern("rocaille", [] { return rocaillePattern(); });
+    pattern("protean_clouds", [] { return proteanCloudsPattern(); });
+    pattern("octgrams", [] { return octgramsPattern(); });
+    pattern("rotating_squares", [] { return rotatingSquaresPattern(); });
+    pattern("starry_planes", [] { return starryPlanesPattern(); });
+    pattern("trig_field", [] { return trigFieldPattern(); });
+    pattern("star_field_travel", [] { return starFieldTravelPattern(); });
+
+    // transforms/, each over noisePattern() so rows are comparable with
+    // pattern,noise.
+    transform("flow_field", [] { return transformCase(FlowFieldTransform(), "flow_field"); });
+    transform("kaleidoscope", [] { return transformCase(KaleidoscopeTransform(6, true), "kaleidoscope"); });
+    transform("palette", [] {
+        return LayerBuilder(noisePattern(), Rainbow_gp, "palette")
+                .addPaletteTransform(PaletteTransform(noise(constant(600)), constant(0)));
+    });
+    transform("radial_kaleidoscope", [] {
+        return transformCase(RadialKaleidoscopeTransform(4), "radial_kaleidoscope");
+    });
+    transform("rotation", [] { return transformCase(RotationTransform(noise(constant(550))), "rotation"); });
+    transform("tiling", [] { return transformCase(TilingTransform(constant(500)), "tiling"); });
+    transform("translation", [] {
+        return transformCase(TranslationTransform(noise(constant(550)), constant(300)), "translation");
+    });
+    transform("vortex", [] { return transformCase(VortexTransform(noise(constant(500))), "vortex"); });
+    transform("zoom", [] { return transformCase(ZoomTransform(), "zoom"); });
+
+    preset("default", defaultPreset);
+    preset("fabric", fabricPreset);
+    preset("hex_kaleidoscope", hexKaleidoscopePreset);
+    preset("noise_kaleidoscope", noiseKaleidoscopePattern);
+    preset("flow_field", flowFieldPreset);
+    preset("flow_field_dots", flowFieldDotsPreset);
+    preset("flow_field_kaleidoscope", flowFieldKaleidoscopePreset);
+    preset("spiral_sink", spiralSinkPreset);
+    preset("radial_pulse", radialPulsePreset);
+    preset("shockwave", shockwavePreset);
+    preset("vortex_capture", vortexCapturePreset);
+    preset("fractal_trail", fractalTrailPreset);
+    preset("spiral", spiralPreset);
+    preset("annuli", annuliPreset);
+    return cases;
+}
+
+bool parseArgs(int argc, char **argv, Args &args) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (a == "--displays" && hasValue) {
+            args.displaysDir = argv[++i];
+        } else if (a == "--frames" && hasValue) {
+            args.frames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (a == "--warmup" && hasValue) {
+            args.warmupFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (a == "--filter" && hasValue) {
+            args.filter = argv[++i];
+        } else if (a == "--predict") {
+            args.predict = true;
+        } else if (a == "--kernels") {
+            args.kernels = true;
+        } else {
+            return false;
+        }
+    }
+    return args.frames > 0;
+}
+
+void usage() {
+    std::fprintf(stderr,
+        "usage: native_bench [--displays <dir>] [--frames N] [--warmup N] [--filter <substr>] [--predict]\n"
+        "       native_bench --kernels [--frames N] [--filter <substr>]\n"
+        "  --filter matches against \"kind/name\", e.g. pattern/ or preset/fabric\n");
+}
+
+struct BenchDisplay {
+    std::string name;
+    std::unique_ptr<LoadedDisplaySpec> spec;
+};
+
+std::vector<BenchDisplay> loadDisplays(const std::string &dir) {
+    std::vector<std::filesystem::path> paths;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".pds") {
+            paths.push_back(entry.path());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<BenchDisplay> displays;
+    for (const auto &path : paths) {
+        std::vector<uint8_t> bytes;
+        if (!readFile(path.string(), bytes)) {
+            std::fprintf(stderr, "warning: cannot read %s\n", path.string().c_str());
+            continue;
+        }
+        DisplaySpecDecodeStatus status = DisplaySpecDecodeStatus::OK;
+        std::unique_ptr<LoadedDisplaySpec> spec = decodeDisplaySpec(bytes.data(), bytes.size(), &status);
+        if (!spec || spec->nbLeds() == 0) {
+            std::fprintf(stderr, "warning: skipping %s (status %u)\n",
+                         path.string().c_str(), static_cast<unsigned>(status));
+            continue;
+        }
+        displays.push_back({path.stem().string(), std::move(spec)});
+    }
+    return displays;
+}
+
+// Renders warmup + measured frames and returns the measured wall time.
+CaseResult runCase(const BenchCase &benchCase, const LoadedDisplaySpec &spec, const Args &args) {
+    const std::function<LayerBuilder()> &builder = benchCase.builder;
+    PolarRenderer renderer(
+        spec.nbLeds(),
+        [&spec](uint16_t i) { return spec.toRenderPoint(i); },
+        std::make_unique<DefaultSceneProvider>([&builder]() {
+            fl::vector<std::shared_ptr<Layer> > layers;
+            layers.push_back(std::make_shared<Layer>(builder().build()));
+            return std::make_unique<Scene>(std::move(layers));
+        })
+    );
+    std::vector<CRGB> leds(spec.nbLeds());
+
+    TimeMillis timeMs = 0;
+    for (uint32_t f = 0; f < args.warmupFrames; ++f) {
+        renderer.render(leds.data(), timeMs);
+        timeMs += FRAME_INTERVAL_MS;
+    }
+
+    OpCounter::reset();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t f = 0; f < args.frames; ++f) {
+        renderer.render(leds.data(), timeMs);
+        timeMs += FRAME_INTERVAL_MS;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    CaseResult result;
+    result.totalNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    result.advanceOps = OpCounter::counts(OpStage::Advance).perFrame(OpCounter::frames());
+    result.renderOps = OpCounter::counts(OpStage::Render).perFrame(OpCounter::frames());
+    return result;
+}
+
+// The Gray-Scott step before GrayScott.h: toroidal indices resolved with
+// branches on every cell and 64-bit diffusion/reaction products.
+void grayScottPerCell(const uint16_t *U, const uint16_t *V, uint16_t *Un, uint16_t *Vn,
+                      uint16_t W, uint16_t H, const grayscott::Params &p) {
+    const uint32_t fk = p.f + p.k;
+    for (uint16_t y = 0; y < H; ++y) {
+        for (uint16_t x = 0; x < W; ++x) {
+            const uint32_t idx = static_cast<uint32_t>(y) * W + x;
+            const uint32_t il = static_cast<uint32_t>(x == 0 ? W - 1 : x - 1) + static_cast<uint32_t>(y) * W;
+            const uint32_t ir = static_cast<uint32_t>(x == W - 1 ? 0 : x + 1) + static_cast<uint32_t>(y) * W;
+            const uint32_t iu = static_cast<uint32_t>(x) + static_cast<uint32_t>(y == 0 ? H - 1 : y - 1) * W;
+            const uint32_t id = static_cast<uint32_t>(x) + static_cast<uint32_t>(y == H - 1 ? 0 : y + 1) * W;
+            const int32_t u = U[idx];
+            const int32_t v = V[idx];
+            const int32_t lapU = static_cast<int32_t>(U[il]) + U[ir] + U[iu] + U[id] - 4 * u;
+            const int32_t lapV = static_cast<int32_t>(V[il]) + V[ir] + V[iu] + V[id] - 4 * v;
+            const int32_t diffU = static_cast<int32_t>((static_cast<int64_t>(p.du) * lapU) >> 16);
+            const int32_t diffV = static_cast<int32_t>((static_cast<int64_t>(p.dv) * lapV) >> 16);
+            const int32_t uv = static_cast<int32_t>((static_cast<uint64_t>(u) * static_cast<uint64_t>(v)) >> 16);
+            const int32_t uv2 = static_cast<int32_t>((static_cast<uint64_t>(uv) * static_cast<uint64_t>(v)) >> 16);
+            const int32_t feed = static_cast<int32_t>((p.f * static_cast<uint32_t>(65536 - u)) >> 16);
+            const int32_t kill = static_cast<int32_t>((fk * static_cast<uint32_t>(v)) >> 16);
+            Un[idx] = static_cast<uint16_t>(std::min(std::max(u + diffU - uv2 + feed, 0), 65535));
+            Vn[idx] = static_cast<uint16_t>(std::min(std::max(v + diffV + uv2 - kill, 0), 65535));
+        }
+    }
+}
+
+// Buffers shared by every kernel: u/v hold the state, un/vn the next step;
+// each step swaps them itself. disp and the lane shifts give the advection
+// kernels a fixed swirl to follow.
+struct KernelGrid {
+    uint16_t n = 0;
+    std::vector<uint16_t> u, v, un, vn;
+    std::vector<Vec2I32> disp;
+    std::vector<fl::s16x16> rowShift, columnShift;
+};
+
+using KernelStepFn = void (*)(KernelGrid &);
+
+// The 2D advection loop before GridUtils took a template field: the vector
+// field is called through a pointer with untyped params on every cell.
+// noinline stands in for TransportPattern's old per-mode switch, which was
+// too large for the compiler to fold into the loop.
+using VectorFnPtr = Vec2I32 (*)(uint8_t x, uint8_t y, uint8_t gridSize, const void *params);
+
+__attribute__((noinline)) Vec2I32 tableVector(uint8_t x, uint8_t y, uint8_t gridSize, const void *params) {
+    return static_cast<const Vec2I32 *>(params)[static_cast<size_t>(y) * gridSize + x];
+}
+
+void advectFnPtr(const uint16_t *source, uint16_t *dest, uint8_t gridSize,
+                 VectorFnPtr vectorFn, const void *params, u0x16 fadeFactor) {
+    for (uint8_t y = 0; y < gridSize; ++y) {
+        const int32_t yCenter = (static_cast<int32_t>(y) << 16) + (S0X16_ONE >> 1);
+        for (uint8_t x = 0; x < gridSize; ++x) {
+            const int32_t xCenter = (static_cast<int32_t>(x) << 16) + (S0X16_ONE >> 1);
+            const Vec2I32 d = vectorFn(x, y, gridSize, params);
+            const uint16_t sampled = grid::sampleGridBilinearWrapped(source, gridSize, xCenter - d.x, yCenter - d.y);
+            dest[static_cast<size_t>(y) * gridSize + x] = scaleU16ByU0x16(sampled, fadeFactor);
+        }
+    }
+}
+
+// The lane sampler before grid::advectLanesWrapped: two modulos per cell to
+// find the shifted neighbours.
+uint16_t sampleShiftedLanePerCell(const uint16_t *cells, size_t base, size_t stride, uint8_t length,
+                                  uint8_t index, fl::s16x16 shift) {
+    const int32_t spanRaw = static_cast<int32_t>(length) << 16;
+    int32_t coordRaw = ((static_cast<int32_t>(index) << 16) - raw(shift)) % spanRaw;
+    if (coordRaw < 0) coordRaw += spanRaw;
+    const uint8_t lower = static_cast<uint8_t>(coordRaw >> 16);
+    const uint8_t upper = static_cast<uint8_t>((lower + 1u) % length);
+    return lerpU16ByQ16(cells[base + lower * stride], cells[base + upper * stride],
+                        u0x16(static_cast<uint16_t>(coordRaw & 0xFFFF)));
+}
+
+constexpr u0x16 kKernelFade(64880u);
+
+struct KernelCase {
+    const char *name;
+    KernelStepFn step;
+};
+
+// Runs --kernels: each solver core on square grids from the default 20x20 up
+// to the 64x64 raster limit, seeded identically, timed over args.frames
+// steps. Returns the number of rows printed.
+size_t runKernels(const Args &args) {
+    static const grayscott::Params coral{13107, 6554, 3604, 4063};
+    const KernelCase kernels[] = {
+        {"gray_scott_per_cell", [](KernelGrid &g) {
+            grayScottPerCell(g.u.data(), g.v.data(), g.un.data(), g.vn.data(), g.n, g.n, coral);
+            g.u.swap(g.un);
+            g.v.swap(g.vn);
+        }},
+        {"gray_scott_rows", [](KernelGrid &g) {
+            grayscott::stepRows(g.u.data(), g.v.data(), g.un.data(), g.vn.data(), g.n, g.n, 0, g.n, coral);
+            g.u.swap(g.un);
+            g.v.swap(g.vn);
+        }},
+        {"advect_fn_ptr", [](KernelGrid &g) {
+            advectFnPtr(g.u.data(), g.un.data(), static_cast<uint8_t>(g.n), tableVector, g.disp.data(), kKernelFade);
+            g.u.swap(g.un);
+        }},
+        {"advect_inline", [](KernelGrid &g) {
+            const Vec2I32 *disp = g.disp.data();
+            grid::advectGrid2DBackward(
+                g.u.data(), g.un.data(), static_cast<uint8_t>(g.n),
+                [disp](uint8_t, uint8_t, size_t index) { return disp[index]; }, kKernelFade);
+            g.u.swap(g.un);
+        }},
+        {"lanes_per_cell", [](KernelGrid &g) {
+            const uint8_t n = static_cast<uint8_t>(g.n);
+            for (uint8_t y = 0; y < n; ++y) {
+                for (uint8_t x = 0; x < n; ++x) {
+                    g.un[static_cast<size_t>(y) * n + x] =
+                        sampleShiftedLanePerCell(g.u.data(), static_cast<size_t>(y) * n, 1u, n, x, g.rowShift[y]);
+                }
+            }
+            for (uint8_t x = 0; x < n; ++x) {
+                for (uint8_t y = 0; y < n; ++y) {
+                    g.u[static_cast<size_t>(y) * n + x] = scaleU16ByU0x16(
+                        sampleShiftedLanePerCell(g.un.data(), x, n, n, y, g.columnShift[x]), kKernelFade);
+                }
+            }
+        }},
+        {"lanes_wrapped", [](KernelGrid &g) {
+            const fl::s16x16 *rows = g.rowShift.data();
+            const fl::s16x16 *columns = g.columnShift.data();
+            grid::advectLanesWrapped(
+                g.u.data(), g.un.data(), static_cast<uint8_t>(g.n),
+                [rows](uint8_t y) { return rows[y]; }, [columns](uint8_t x) { return columns[x]; }, kKernelFade);
+        }},
+    };
+    const uint16_t grids[] = {20, 32, 48, 64};
+
+    std::printf("kind,name,grid,cells,steps,ns_per_step,ns_per_cell\n");
+    size_t rows = 0;
+    for (const KernelCase &kernel : kernels) {
+        const std::string id = std::string("kernel/") + kernel.name;
+        if (!args.filter.empty() && id.find(args.filter) == std::string::npos) continue;
+
+        for (uint16_t n : grids) {
+            const size_t cells = static_cast<size_t>(n) * n;
+            KernelGrid g;
+            g.n = n;
+            g.u.assign(cells, 65535);
+            g.v.assign(cells, 0);
+            g.un.resize(cells);
+            g.vn.resize(cells);
+            for (size_t i = 0; i < cells; i += 7) {
+                g.u[i] = 32768;
+                g.v[i] = static_cast<uint16_t>(16384 + (i & 0x3F));
+            }
+            // A swirl of up to ~1.5 cells around the centre, and sub-cell lane
+            // shifts of both signs.
+            g.disp.resize(cells);
+            for (uint16_t y = 0; y < n; ++y) {
+                for (uint16_t x = 0; x < n; ++x) {
+                    const int32_t dx = (static_cast<int32_t>(x) * 2 - n) << 14;
+                    const int32_t dy = (static_cast<int32_t>(y) * 2 - n) << 14;
+                    g.disp[static_cast<size_t>(y) * n + x] = Vec2I32{-dy / n * 3, dx / n * 3};
+                }
+            }
+            for (uint16_t i = 0; i < n; ++i) {
+                g.rowShift.push_back(fl::s16x16::from_raw((static_cast<int32_t>(i) * 7919 % 131072) - 65536));
+                g.columnShift.push_back(fl::s16x16::from_raw((static_cast<int32_t>(i) * 104729 % 131072) - 65536));
+            }
+            for (uint32_t f = 0; f < args.warmupFrames; ++f) kernel.step(g);
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t f = 0; f < args.frames; ++f) kernel.step(g);
+            const auto end = std::chrono::steady_clock::now();
+            const double nsPerStep = static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / args.frames;
+            std::printf("kernel,%s,%ux%u,%zu,%u,%.0f,%.2f\n", kernel.name,
+                        static_cast<unsigned>(n), static_cast<unsigned>(n), cells,
+                        static_cast<unsigned>(args.frames), nsPerStep, nsPerStep / cells);
+            std::fflush(stdout);
+            ++rows;
+        }
+    }
+    return rows;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Args args;
+    if (!parseArgs(argc, argv, args)) {
+        usage();
+        return 2;
+    }
+
+    // The native Serial mock logs through std::cout (e.g. Layer::build()); send
+    // it to stderr so stdout carries only CSV.
+    std::cout.rdbuf(std::cerr.rdbuf());
+
+#if !POLAR_SHADER_COUNT_OPS
+    if (args.predict) {
+        std::fprintf(stderr, "error: --predict needs a build with POLAR_SHADER_COUNT_OPS=1\n");
+        return 2;
+    }
+#endif
+
+    if (args.kernels) {
+        if (runKernels(args) == 0) {
+            std::fprintf(stderr, "error: --filter \"%s\" matched no kernels\n", args.filter.c_str());
+            return 1;
+        }
+        return 0;
+    }
+
+    const std::vector<BenchDisplay> displays = loadDisplays(args.displaysDir);
+    if (displays.empty()) {
+        std::fprintf(stderr, "error: no .pds displays found in %s\n", args.displaysDir.c_str());
+        return 1;
+    }
+
+    const std::vector<BenchCase> cases = buildCases();
+    std::printf("kind,name,display,leds,frames,ns_per_frame,ns_per_pixel");
+    if (args.predict) {
+        for (size_t op = 0; op < COUNTED_OP_COUNT; ++op) {
+            std::printf(",%s_px", countedOpName(static_cast<CountedOp>(op)));
+        }
+        for (size_t op = 0; op < COUNTED_OP_COUNT; ++op) {
+            std::printf(",%s_frame", countedOpName(static_cast<CountedOp>(op)));
+        }
+        for (size_t b = 0; b < BOARD_COST_TABLE_COUNT; ++b) {
+            std::printf(",%s_ms", BOARD_COST_TABLES[b].name);
+        }
+        std::printf(",noise_hit_pct");
+    }
+    std::printf("\n");
+    size_t rows = 0;
+    for (const BenchCase &benchCase : cases) {
+        const std::string id = std::string(benchCase.kind) + "/" + benchCase.name;
+        if (!args.filter.empty() && id.find(args.filter) == std::string::npos) continue;
+
+        for (const BenchDisplay &display : displays) {
+            const uint16_t leds = display.spec->nbLeds();
+            const CaseResult result = runCase(benchCase, *display.spec, args);
+            const double nsPerFrame = static_cast<double>(result.totalNs) / args.frames;
+            std::printf("%s,%s,%s,%u,%u,%.0f,%.2f",
+                        benchCase.kind, benchCase.name, display.name.c_str(),
+                        static_cast<unsigned>(leds), static_cast<unsigned>(args.frames),
+                        nsPerFrame, nsPerFrame / leds);
+            if (args.predict) {
+                for (uint64_t count : result.renderOps.ops) {
+                    std::printf(",%.2f", static_cast<double>(count) / leds);
+                }
+                for (uint64_t count : result.advanceOps.ops) {
+                    std::printf(",%llu", static_cast<unsigned long long>(count));
+                }
+                for (size_t b = 0; b < BOARD_COST_TABLE_COUNT; ++b) {
+                    const FramePrediction prediction =
+                            predictFrame(BOARD_COST_TABLES[b], result.advanceOps, result.renderOps, leds);
+                    std::printf(",%.2f", prediction.frameMicros / 1000.0);
+                }
+                const uint64_t probes = result.renderOps[CountedOp::NoiseProbe];
+                if (probes) {
+                    std::printf(",%.1f", 100.0 * result.renderOps[CountedOp::NoiseHit] / probes);
+                } else {
+                    std::printf(",");
+                }
+            }
+            std::printf("\n");
+            std::fflush(stdout);
+            ++rows;
+        }
+        std::fprintf(stderr, "native_bench: %s done\n", id.c_str());
+    }
+
+    if (rows == 0) {
+        std::fprintf(stderr, "error: --filter \"%s\" matched no cases\n", args.filter.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -167,6 +167,18 @@ namespace {
             return *this;
         }
 
+        // v2 header; follow with layer_n layer() prefixes and bodies.
+        WireBuilder &layeredHeader(uint8_t layerCount) {
+            u8('P'); u8('S'); u8('C'); u8(0);
+            u8(2);             // version
+            u8(layerCount);
+            return *this;
+        }
+
+        WireBuilder &layer(uint16_t alpha, uint8_t blendMode, uint8_t paletteId) {
+            return u16(alpha).u8(blendMode).u8(paletteId);
+        }
+
         WireBuilder &u8(uint8_t v) { data_.push_back(v); return *this; }
         WireBuilder &u16(uint16_t v) {
             data_.push_back(static_cast<uint8_t>(v & 0xFF));
@@ -1300,6 +1312,149 @@ void test_decode_v1_length_prefixed_fixture() {
     decoded->compile();
 }
 
+namespace {
+    // Noise with constant(550) under a Zoom, as in the v1 golden fixture.
+    void appendNoiseZoomLayerBody(WireBuilder &w) {
+        w.record(PAT_NOISE_BASIC, [](WireBuilder &body) { body.sigConstant(550); });
+        w.u8(1);
+        w.record(TFM_ZOOM, [](WireBuilder &body) { body.sigConstant(200); });
+    }
+
+    void appendTurbulenceLayerBody(WireBuilder &w) {
+        w.record(PAT_NOISE_TURBULENCE, [](WireBuilder &) {});
+        w.u8(0);
+    }
+
+    // Null when the bytes do not decode. Reseeds first so the bottom noise
+    // layer draws the same depth seed in every scene being compared.
+    std::unique_ptr<Scene> decodeAndAdvance(const WireBuilder &w) {
+        randomSeed(1234);
+        auto scene = decodeScene(w.data(), w.size());
+        if (!scene) return nullptr;
+        scene->compile();
+        scene->advanceFrame(u0x16(0x4000u), 1000);
+        return scene;
+    }
+}
+
+void test_decode_v2_layered_js_fixture() {
+    // Generated by web/sketches/composer/codec.js (LAYERED_FIXTURE in
+    // web/test_codec.mjs): the v1 golden scene under a half-alpha Screen
+    // layer of turbulence noise on palette 2.
+    static const uint8_t kLayeredFixture[] = {
+        0x50, 0x53, 0x43, 0x00,
+        0x02,                     // version 2
+        0x02,                     // two layers
+        0xFF, 0xFF, 0x00,         // alpha 0xFFFF, Normal
+        0x00,                     // palette 0
+        0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x26, 0x02,
+        0x01,
+        0x02, 0x05, 0x00, 0x00, 0x02, 0x00, 0xC8, 0x00,
+        0x00, 0x80, 0x03,         // alpha 0x8000, Screen
+        0x02,                     // palette 2
+        0x02, 0x00, 0x00,         // PAT_NOISE_TURBULENCE, empty body
+        0x00,
+    };
+
+    DecodeStatus status;
+    auto decoded = decodeScene(kLayeredFixture, sizeof(kLayeredFixture), &status);
+    TEST_ASSERT_EQUAL(static_cast<int>(DecodeStatus::OK), static_cast<int>(status));
+    TEST_ASSERT_NOT_NULL(decoded.get());
+
+    const auto &layers = decoded->getLayers();
+    TEST_ASSERT_EQUAL_UINT32(2, static_cast<uint32_t>(layers.size()));
+    TEST_ASSERT_EQUAL_UINT16(0xFFFF, raw(layers[0]->getAlpha()));
+    TEST_ASSERT_EQUAL(static_cast<int>(BlendMode::Normal), static_cast<int>(layers[0]->getBlendMode()));
+    TEST_ASSERT_EQUAL_UINT16(0x8000, raw(layers[1]->getAlpha()));
+    TEST_ASSERT_EQUAL(static_cast<int>(BlendMode::Screen), static_cast<int>(layers[1]->getBlendMode()));
+    decoded->compile();
+}
+
+void test_decode_v2_layers_composite_with_alpha_and_blend() {
+    WireBuilder v1;
+    v1.header(0);
+    appendNoiseZoomLayerBody(v1);
+
+    WireBuilder single;
+    single.layeredHeader(1).layer(0xFFFF, static_cast<uint8_t>(BlendMode::Normal), 0);
+    appendNoiseZoomLayerBody(single);
+
+    WireBuilder hiddenTop;
+    hiddenTop.layeredHeader(2).layer(0xFFFF, static_cast<uint8_t>(BlendMode::Normal), 0);
+    appendNoiseZoomLayerBody(hiddenTop);
+    hiddenTop.layer(0, static_cast<uint8_t>(BlendMode::Normal), 2);
+    appendTurbulenceLayerBody(hiddenTop);
+
+    WireBuilder screenTop;
+    screenTop.layeredHeader(2).layer(0xFFFF, static_cast<uint8_t>(BlendMode::Normal), 0);
+    appendNoiseZoomLayerBody(screenTop);
+    screenTop.layer(0x8000, static_cast<uint8_t>(BlendMode::Screen), 2);
+    appendTurbulenceLayerBody(screenTop);
+
+    auto base = decodeAndAdvance(v1);
+    auto singleScene = decodeAndAdvance(single);
+    auto hiddenScene = decodeAndAdvance(hiddenTop);
+    auto screenScene = decodeAndAdvance(screenTop);
+    TEST_ASSERT_NOT_NULL(base.get());
+    TEST_ASSERT_NOT_NULL(singleScene.get());
+    TEST_ASSERT_NOT_NULL(hiddenScene.get());
+    TEST_ASSERT_NOT_NULL(screenScene.get());
+
+    bool screenChangedSample = false;
+    for (uint16_t i = 0; i < 16; ++i) {
+        const u0x16 angle(static_cast<uint16_t>(i * 4099u));
+        const u0x16 radius(static_cast<uint16_t>(4096u + i * 3800u));
+        const ::CRGB expected = base->sample(0, angle, radius);
+        const ::CRGB one = singleScene->sample(0, angle, radius);
+        const ::CRGB hidden = hiddenScene->sample(0, angle, radius);
+        const ::CRGB screened = screenScene->sample(0, angle, radius);
+        TEST_ASSERT_EQUAL_UINT8(expected.r, one.r);
+        TEST_ASSERT_EQUAL_UINT8(expected.g, one.g);
+        TEST_ASSERT_EQUAL_UINT8(expected.b, one.b);
+        // A zero-alpha top layer leaves the bottom untouched.
+        TEST_ASSERT_EQUAL_UINT8(expected.r, hidden.r);
+        TEST_ASSERT_EQUAL_UINT8(expected.g, hidden.g);
+        TEST_ASSERT_EQUAL_UINT8(expected.b, hidden.b);
+        // Screen only brightens.
+        TEST_ASSERT_TRUE(screened.r >= expected.r && screened.g >= expected.g && screened.b >= expected.b);
+        if (screened.r != expected.r || screened.g != expected.g || screened.b != expected.b) {
+            screenChangedSample = true;
+        }
+    }
+    TEST_ASSERT_TRUE(screenChangedSample);
+}
+
+void test_decode_v2_rejects_bad_layer_count_and_blend_mode() {
+    DecodeStatus status;
+
+    WireBuilder empty;
+    empty.layeredHeader(0);
+    TEST_ASSERT_NULL(decodeScene(empty.data(), empty.size(), &status).get());
+    TEST_ASSERT_EQUAL(static_cast<int>(DecodeStatus::BAD_VALUE), static_cast<int>(status));
+
+    WireBuilder tooMany;
+    tooMany.layeredHeader(POLAR_SHADER_PSC_MAX_LAYERS + 1);
+    for (uint8_t i = 0; i < POLAR_SHADER_PSC_MAX_LAYERS + 1; ++i) {
+        tooMany.layer(0xFFFF, 0, 0);
+        appendTurbulenceLayerBody(tooMany);
+    }
+    TEST_ASSERT_NULL(decodeScene(tooMany.data(), tooMany.size(), &status).get());
+    TEST_ASSERT_EQUAL(static_cast<int>(DecodeStatus::BAD_VALUE), static_cast<int>(status));
+
+    WireBuilder badBlend;
+    badBlend.layeredHeader(1).layer(0xFFFF, static_cast<uint8_t>(BlendMode::Screen) + 1, 0);
+    appendTurbulenceLayerBody(badBlend);
+    TEST_ASSERT_NULL(decodeScene(badBlend.data(), badBlend.size(), &status).get());
+    TEST_ASSERT_EQUAL(static_cast<int>(DecodeStatus::BAD_ENUM), static_cast<int>(status));
+
+    // A missing second layer is a truncation, not a silent one-layer scene.
+    WireBuilder missing;
+    missing.layeredHeader(2).layer(0xFFFF, 0, 0);
+    appendTurbulenceLayerBody(missing);
+    TEST_ASSERT_NULL(decodeScene(missing.data(), missing.size(), &status).get());
+    TEST_ASSERT_EQUAL(static_cast<int>(DecodeStatus::TRUNCATED), static_cast<int>(status));
+}
+
 void test_decode_js_generated_lockstep_fixtures() {
     // These byte arrays were generated by web/sketches/composer/codec.js from
     // the web schema. They intentionally do not use WireBuilder, so they catch
@@ -2121,6 +2276,9 @@ void setup() {
     RUN_TEST(test_embedded_psc_playlist_provider_has_builtin_fallback);
     RUN_TEST(test_decode_golden_fixture);
     RUN_TEST(test_decode_v1_length_prefixed_fixture);
+    RUN_TEST(test_decode_v2_layered_js_fixture);
+    RUN_TEST(test_decode_v2_layers_composite_with_alpha_and_blend);
+    RUN_TEST(test_decode_v2_rejects_bad_layer_count_and_blend_mode);
     RUN_TEST(test_decode_js_generated_lockstep_fixtures);
     RUN_TEST(test_decode_v1_rejects_trailing_pattern_body_bytes);
     RUN_TEST(test_decode_v1_rejects_trailing_signal_body_bytes);
@@ -2191,6 +2349,9 @@ int main() {
     RUN_TEST(test_embedded_psc_playlist_provider_has_builtin_fallback);
     RUN_TEST(test_decode_golden_fixture);
     RUN_TEST(test_decode_v1_length_prefixed_fixture);
+    RUN_TEST(test_decode_v2_layered_js_fixture);
+    RUN_TEST(test_decode_v2_layers_composite_with_alpha_and_blend);
+    RUN_TEST(test_decode_v2_rejects_bad_layer_count_and_blend_mode);
     RUN_TEST(test_decode_js_generated_lockstep_fixtures);
     RUN_TEST(test_decode_v1_rejects_trailing_pattern_body_bytes);
     RUN_TEST(test_decode_v1_rejects_trailing_signal_body_bytes);
@@ -22,6 +22,7 @@
 #include "renderer/pipeline/maths/src/PatternMaths.cpp"
 #include "renderer/pipeline/maths/src/TimeMaths.cpp"
 #include "renderer/pipeline/signals/src/Signals.cpp"
+#include "renderer/pipeline/signals/src/SignalProgram.cpp"
 #include "renderer/pipeline/signals/src/SignalSamplers.cpp"
 #include "renderer/pipeline/signals/src/accumulators/Accumulators.cpp"
 #include "renderer/pipeline/transforms/src/PaletteTransform.cpp"
@@ -219,6 +220,318 @@ void test_smap_preserves_aperiodic_metadata() {
     TEST_ASSERT_EQUAL_UINT32(750u, s.duration());
 }
 
+/** @brief Verify each factory reports whether it can be sampled at any time. */
+void test_signal_evaluation_modes() {
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::CONSTANT),
+                          static_cast<int>(constant(300).evaluation()));
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::CONSTANT),
+                          static_cast<int>(smap(constant(500), constant(100), constant(800)).evaluation()));
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::CLOSED_FORM),
+                          static_cast<int>(sine(constant(1000)).evaluation()));
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::CLOSED_FORM),
+                          static_cast<int>(linear(1000).evaluation()));
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::CLOSED_FORM),
+                          static_cast<int>(noise(linear(1000), s0x16(1)).evaluation()));
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::INTEGRATED),
+                          static_cast<int>(sine(triangle(constant(100))).evaluation()));
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::INTEGRATED),
+                          static_cast<int>(smap(linear(1000), sine(linear(500)), constant(1000)).evaluation()));
+
+    TEST_ASSERT_TRUE(scale(sawtooth(constant(250)), u0x16(0x8000)).isSeekable());
+    TEST_ASSERT_TRUE(S0x16Signal().isSeekable());
+    TEST_ASSERT_FALSE(S0x16Signal::periodic([](TimeMillis) { return s0x16(0); }).isSeekable());
+}
+
+/** @brief Verify a constant-rate signal seeks straight to a late time and agrees with frame-by-frame stepping. */
+void test_seekable_sine_matches_stepped_integration() {
+    const TimeMillis target = 60000;
+    S0x16Signal stepped = sine(constant(730), s0x16(4096));
+    for (TimeMillis t = 0; t < target; t += 16) {
+        (void) stepped.sample(SIGNED_RANGE, t);
+    }
+
+    S0x16Signal seeked = sine(constant(730), s0x16(4096));
+    const int32_t direct = raw(seeked.sample(SIGNED_RANGE, target));
+    TEST_ASSERT_INT32_WITHIN(64, raw(stepped.sample(SIGNED_RANGE, target)), direct);
+
+    // Seeking backwards and forwards again lands on the same value.
+    (void) seeked.sample(SIGNED_RANGE, 123);
+    TEST_ASSERT_EQUAL_INT32(direct, raw(seeked.sample(SIGNED_RANGE, target)));
+}
+
+/** @brief Verify a time-varying rate still integrates frame by frame. */
+void test_modulated_rate_signal_integrates() {
+    S0x16Signal first = sine(linear(2000, LoopMode::SATURATE), s0x16(0));
+    S0x16Signal second = sine(linear(2000, LoopMode::SATURATE), s0x16(0));
+
+    (void) first.sample(SIGNED_RANGE, 0);
+    (void) second.sample(SIGNED_RANGE, 0);
+    for (TimeMillis t = 100; t <= 1000; t += 100) {
+        (void) first.sample(SIGNED_RANGE, t);
+    }
+    (void) second.sample(SIGNED_RANGE, 1000);
+
+    // The phase depends on the samples taken, so a skipped history gives a different value.
+    TEST_ASSERT_NOT_EQUAL(raw(first.sample(SIGNED_RANGE, 1100)), raw(second.sample(SIGNED_RANGE, 1100)));
+}
+
+/** @brief Verify nested factories build one flat program instead of a tree of closures. */
+void test_signal_tree_flattens_into_one_program() {
+    S0x16Signal s = smap(sine(triangle(constant(100))), linear(1000), constant(800));
+
+    // smap, integrated sine, closed-form triangle, linear and one constant; the triangle's constant
+    // rate is folded into its node.
+    TEST_ASSERT_EQUAL_UINT16(5, s.program().size());
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalOp::SMAP), static_cast<int>(s.program().root().op));
+    TEST_ASSERT_EQUAL_UINT16(1, s.program().root().child[0]);
+    TEST_ASSERT_EQUAL_UINT16(3, s.program().root().child[1]);
+    TEST_ASSERT_EQUAL_UINT16(4, s.program().root().child[2]);
+}
+
+/** @brief Verify a custom waveform spliced into a program keeps its own aperiodic window. */
+void test_signal_program_wraps_custom_waveform() {
+    S0x16Signal custom = S0x16Signal::aperiodic(1000, LoopMode::RESET, [](TimeMillis t) {
+        return s0x16(static_cast<int32_t>(t) * 65);
+    });
+    S0x16Signal scaled = scale(custom, u0x16(0x8000));
+
+    TEST_ASSERT_EQUAL_UINT16(2, scaled.program().size());
+    TEST_ASSERT_FALSE(custom.program());
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(SignalEvaluation::INTEGRATED), static_cast<int>(scaled.evaluation()));
+    for (TimeMillis t = 0; t < 3000; t += 250) {
+        TEST_ASSERT_EQUAL_INT32(
+            raw(mulS0x16Sat(custom.sample(SIGNED_RANGE, t), s0x16(0x8000))),
+            raw(scaled.sample(SIGNED_RANGE, t)));
+    }
+}
+
+namespace {
+    // Closure-tree reference for SignalProgram::evaluate(): every node is a custom waveform that
+    // samples its children through S0x16Signal::sample(), with integrated phases advanced by
+    // PhaseAccumulator and shapes and noise read from the SignalSamplers evaluators.
+    namespace reference {
+        using ShapeFn = s0x16 (*)(u0x16);
+
+        u0x16 progress(TimeMillis t, TimeMillis duration) {
+            if (t >= duration) t = duration;
+            uint64_t scaled = (static_cast<uint64_t>(t) * UINT16_MAX) / duration;
+            if (scaled > UINT16_MAX) scaled = UINT16_MAX;
+            return u0x16(static_cast<uint16_t>(scaled));
+        }
+
+        S0x16Signal constant(uint16_t perMil) {
+            const u0x16 value(static_cast<uint16_t>((static_cast<uint32_t>(perMil) * 0xFFFFu) / 1000u));
+            return S0x16Signal::periodic([value](TimeMillis) { return toSigned(value); });
+        }
+
+        S0x16Signal linear(TimeMillis duration, LoopMode loopMode) {
+            return S0x16Signal::aperiodic(duration, loopMode, [duration](TimeMillis t) {
+                return toSigned(progress(t, duration));
+            });
+        }
+
+        S0x16Signal quadraticIn(TimeMillis duration, LoopMode loopMode) {
+            return S0x16Signal::aperiodic(duration, loopMode, [duration](TimeMillis t) {
+                const uint32_t p = raw(progress(t, duration));
+                return toSigned(u0x16(static_cast<uint16_t>((static_cast<uint64_t>(p) * p + (1u << 15)) >> 16)));
+            });
+        }
+
+        S0x16Signal closedForm(ShapeFn shape, uint16_t speedPerMil) {
+            const s0x16 speed = constant(speedPerMil).sample(magnitudeRange(), 0);
+            return S0x16Signal::periodic([shape, speed](TimeMillis t) {
+                return shape(u0x16(static_cast<uint16_t>(phaseAtConstantSpeedRaw(u0x16(0), speed, t) >> 16)));
+            });
+        }
+
+        S0x16Signal integrated(ShapeFn shape, S0x16Signal velocity, u0x16 phaseOffset) {
+            PhaseAccumulator acc([velocity = std::move(velocity)](TimeMillis t) {
+                return velocity.sample(magnitudeRange(), t);
+            }, phaseOffset);
+            return S0x16Signal::periodic([shape, acc = std::move(acc)](TimeMillis t) mutable {
+                return shape(acc.advance(t));
+            });
+        }
+
+        S0x16Signal noise(S0x16Signal velocity, uint16_t phaseOffset) {
+            const uint32_t offsetRaw = static_cast<uint32_t>(phaseOffset) << 16;
+            return S0x16Signal::periodic([velocity = std::move(velocity), offsetRaw](TimeMillis t) {
+                const uint32_t speed = static_cast<uint32_t>(raw(velocity.sample(magnitudeRange(), t)));
+                return noise32At(static_cast<uint32_t>((static_cast<uint64_t>(t) * speed) >> 16) + offsetRaw);
+            });
+        }
+
+        S0x16Signal loopingNoise(S0x16Signal velocity, uint16_t phaseOffset, TimeMillis loopPeriodMs) {
+            const uint32_t offsetRaw = static_cast<uint32_t>(phaseOffset) << 16;
+            return S0x16Signal::periodic([
+                velocity = std::move(velocity), offsetRaw, loopPeriodMs, span = uint32_t(0), primed = false
+            ](TimeMillis t) mutable {
+                if (!primed) {
+                    const uint32_t speed = static_cast<uint32_t>(raw(velocity.sample(magnitudeRange(), 0)));
+                    span = static_cast<uint32_t>((static_cast<uint64_t>(loopPeriodMs) * speed) >> 16);
+                    primed = true;
+                }
+                const uint16_t phi = static_cast<uint16_t>(
+                    static_cast<uint64_t>(t % loopPeriodMs) * 65535u / loopPeriodMs);
+                const uint32_t coordA = offsetRaw + static_cast<uint32_t>((static_cast<uint64_t>(phi) * span) >> 16);
+                int32_t w = 32767 - static_cast<int32_t>(cos16(static_cast<uint16_t>(phi >> 1)));
+                if (w < 0) w = 0;
+                if (w > 65535) w = 65535;
+                const int32_t a = raw(noise32At(coordA));
+                const int32_t b = raw(noise32At(coordA - span));
+                return s0x16(a + static_cast<int32_t>((static_cast<int64_t>(b - a) * w) >> 16));
+            });
+        }
+
+        S0x16Signal wrap(const S0x16Signal &shape, S0x16Signal::WaveformFn waveform) {
+            if (shape.kind() == SignalKind::APERIODIC) {
+                return S0x16Signal::aperiodic(shape.duration(), shape.loopMode(), std::move(waveform));
+            }
+            return S0x16Signal::periodic(std::move(waveform));
+        }
+
+        S0x16Signal smap(S0x16Signal signal, S0x16Signal floor, S0x16Signal ceiling) {
+            S0x16Signal shape = signal;
+            return wrap(shape, [signal = std::move(signal), floor = std::move(floor), ceiling = std::move(ceiling)](
+                TimeMillis t) {
+                uint32_t floorRaw = static_cast<uint32_t>(raw(floor.sample(magnitudeRange(), t)));
+                uint32_t ceilingRaw = static_cast<uint32_t>(raw(ceiling.sample(magnitudeRange(), t)));
+                if (floorRaw > ceilingRaw) std::swap(floorRaw, ceilingRaw);
+                const uint32_t sourceRaw = raw(toUnsignedClamped(signal.sample(bipolarRange(), t)));
+                const uint32_t mapped = floorRaw + (((ceilingRaw - floorRaw) * sourceRaw + (1u << 15)) >> 16);
+                return toSigned(u0x16(static_cast<uint16_t>(mapped)));
+            });
+        }
+
+        S0x16Signal scale(S0x16Signal signal, u0x16 factor) {
+            S0x16Signal shape = signal;
+            return wrap(shape, [signal = std::move(signal), factor](TimeMillis t) {
+                return mulS0x16Sat(signal.sample(bipolarRange(), t), s0x16(raw(factor)));
+            });
+        }
+    }
+
+    struct ProgramCase {
+        const char *name;
+        S0x16Signal program;
+        S0x16Signal reference;
+    };
+
+    fl::vector<ProgramCase> programCases() {
+        namespace R = reference;
+        fl::vector<ProgramCase> cases;
+        // Integrated sine over a saturating ramp, under bounds with their own windows.
+        cases.push_back({
+            "smap(sine(linear))",
+            smap(sine(linear(2000, LoopMode::SATURATE)), quadraticIn(700), constant(800)),
+            R::smap(R::integrated(sineAt, R::linear(2000, LoopMode::SATURATE), u0x16(0)),
+                    R::quadraticIn(700, LoopMode::RESET), R::constant(800))
+        });
+        // Looping noise whose span comes from a moving velocity read once at epoch 0.
+        cases.push_back({
+            "noise(smap(sine), loop)",
+            noise(smap(sine(constant(50)), constant(300), constant(900)), s0x16(0x1234), 1500),
+            R::loopingNoise(R::smap(R::closedForm(sineAt, 50), R::constant(300), R::constant(900)), 0x1234, 1500)
+        });
+        cases.push_back({
+            "smap(noise(loop), quadraticIn)",
+            smap(noise(constant(400), s0x16(0x2222), 2500), quadraticIn(600), constant(1000)),
+            R::smap(R::loopingNoise(R::constant(400), 0x2222, 2500), R::quadraticIn(600, LoopMode::RESET),
+                    R::constant(1000))
+        });
+        // Integrated triangle driven by noise driven by a ramp.
+        cases.push_back({
+            "triangle(noise(linear))",
+            triangle(noise(linear(900), s0x16(0x0F00)), s0x16(0x4000)),
+            R::integrated(triangleAt, R::noise(R::linear(900, LoopMode::RESET), 0x0F00), u0x16(0x4000))
+        });
+        // Nested integrated phases: the inner one only advances when the outer one reads it.
+        cases.push_back({
+            "sine(triangle(linear))",
+            sine(triangle(linear(1500)), s0x16(0x1000)),
+            R::integrated(sineAt, R::integrated(triangleAt, R::linear(1500, LoopMode::RESET), u0x16(0)),
+                          u0x16(0x1000))
+        });
+        // Aperiodic root whose children window the root's time again.
+        cases.push_back({
+            "smap(linear, quadraticIn, linear)",
+            smap(linear(1000), quadraticIn(300), linear(5000, LoopMode::SATURATE)),
+            R::smap(R::linear(1000, LoopMode::RESET), R::quadraticIn(300, LoopMode::RESET),
+                    R::linear(5000, LoopMode::SATURATE))
+        });
+        cases.push_back({
+            "scale(sine(quadraticIn))",
+            scale(sine(quadraticIn(400)), u0x16(0xC000)),
+            R::scale(R::integrated(sineAt, R::quadraticIn(400, LoopMode::RESET), u0x16(0)), u0x16(0xC000))
+        });
+        return cases;
+    }
+
+    // Repeats, small steps and gaps past MAX_DELTA_TIME_MS, from a fixed LCG.
+    fl::vector<TimeMillis> irregularSchedule(uint32_t seed, TimeMillis start, uint16_t count) {
+        fl::vector<TimeMillis> times;
+        TimeMillis t = start;
+        for (uint16_t i = 0; i < count; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t r = seed >> 8;
+            if (r % 5u != 0u) t += (r % 3u == 0u) ? 250u + r % 700u : 1u + r % 40u;
+            times.push_back(t);
+        }
+        return times;
+    }
+
+    void expectMatchesReference(ProgramCase &c, const fl::vector<TimeMillis> &times) {
+        for (TimeMillis t : times) {
+            TEST_ASSERT_EQUAL_INT32_MESSAGE(
+                raw(c.reference.sample(SIGNED_RANGE, t)),
+                raw(c.program.sample(SIGNED_RANGE, t)),
+                c.name);
+        }
+    }
+}
+
+/** @brief Verify flat programs sample bit-identically to a closure-tree reference. */
+void test_signal_program_matches_closure_reference() {
+    const fl::vector<TimeMillis> backwards{5000, 4980, 4500, 4600, 3000, 3000, 2990, 100, 0, 250, 180, 7000, 6999};
+    for (auto &c : programCases()) {
+        TEST_ASSERT_TRUE_MESSAGE(static_cast<bool>(c.program.program()), c.name);
+        expectMatchesReference(c, irregularSchedule(0x5eed1u, 0, 200));
+    }
+    for (auto &c : programCases()) {
+        expectMatchesReference(c, backwards);
+        expectMatchesReference(c, irregularSchedule(0x5eed2u, 20000, 100));
+    }
+}
+
+/** @brief Verify copies of a program keep their own integrated and primed state. */
+void test_signal_program_copies_match_closure_reference() {
+    for (auto &c : programCases()) {
+        expectMatchesReference(c, irregularSchedule(0x5eed3u, 0, 60));
+        ProgramCase copy{c.name, c.program, c.reference};
+        expectMatchesReference(c, irregularSchedule(0x5eed4u, 8000, 80));
+        expectMatchesReference(copy, irregularSchedule(0x5eed5u, 3000, 80));
+    }
+}
+
+/** @brief Verify constant-only trees fold to inline values with no program behind them. */
+void test_constant_subtrees_fold_to_plain_values() {
+    S0x16Signal folded = smap(constant(500), constant(100), constant(800));
+    TEST_ASSERT_TRUE(folded.isConstant());
+    TEST_ASSERT_FALSE(folded.program());
+    TEST_ASSERT_INT32_WITHIN(100, raw(toSigned(perMil(450))), raw(folded.constantValue()));
+    TEST_ASSERT_EQUAL_INT32(raw(folded.constantValue()), raw(folded.sample(SIGNED_RANGE, 12345)));
+
+    TEST_ASSERT_TRUE(scale(constant(800), u0x16(0x8000)).isConstant());
+    TEST_ASSERT_TRUE(sine(constant(0), s0x16(16384)).isConstant());
+    TEST_ASSERT_INT32_WITHIN(2, S0X16_MAX, raw(sine(constant(0), s0x16(16384)).constantValue()));
+    TEST_ASSERT_TRUE(noise(constant(0), s0x16(99)).isConstant());
+    TEST_ASSERT_FALSE(S0x16Signal().isConstant());
+
+    S0x16Signal partial = smap(sine(constant(100)), constant(100), constant(800));
+    TEST_ASSERT_FALSE(partial.isConstant());
+    TEST_ASSERT_EQUAL_UINT16(4, partial.program().size());
+}
+
 /** @brief Verify zero clip disables feather even when max feather defaults are used. */
 void test_palette_clip_zero_has_zero_feather() {
     auto context = std::make_shared<PipelineContext>();
@@ -275,6 +588,14 @@ void setup() {
     RUN_TEST(test_noise_zero_phase_offset_randomizes_instances);
     RUN_TEST(test_smap_animated_bounds);
     RUN_TEST(test_smap_preserves_aperiodic_metadata);
+    RUN_TEST(test_signal_evaluation_modes);
+    RUN_TEST(test_seekable_sine_matches_stepped_integration);
+    RUN_TEST(test_modulated_rate_signal_integrates);
+    RUN_TEST(test_signal_tree_flattens_into_one_program);
+    RUN_TEST(test_signal_program_wraps_custom_waveform);
+    RUN_TEST(test_signal_program_matches_closure_reference);
+    RUN_TEST(test_signal_program_copies_match_closure_reference);
+    RUN_TEST(test_constant_subtrees_fold_to_plain_values);
     RUN_TEST(test_palette_clip_zero_has_zero_feather);
     RUN_TEST(test_palette_clip_feather_scales_with_clip_signal);
     UNITY_END();
@@ -297,6 +618,14 @@ int main() {
     RUN_TEST(test_noise_zero_phase_offset_randomizes_instances);
     RUN_TEST(test_smap_animated_bounds);
     RUN_TEST(test_smap_preserves_aperiodic_metadata);
+    RUN_TEST(test_signal_evaluation_modes);
+    RUN_TEST(test_seekable_sine_matches_stepped_integration);
+    RUN_TEST(test_modulated_rate_signal_integrates);
+    RUN_TEST(test_signal_tree_flattens_into_one_program);
+    RUN_TEST(test_signal_program_wraps_custom_waveform);
+    RUN_TEST(test_signal_program_matches_closure_reference);
+    RUN_TEST(test_signal_program_copies_match_closure_reference);
+    RUN_TEST(test_constant_subtrees_fold_to_plain_values);
     RUN_TEST(test_palette_clip_zero_has_zero_feather);
     RUN_TEST(test_palette_clip_feather_scales_with_clip_signal);
     return UNITY_END();
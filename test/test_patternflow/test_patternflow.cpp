@@ -49,6 +49,7 @@
 #include "renderer/pipeline/maths/src/TimeMaths.cpp"
 #include "renderer/pipeline/maths/src/TilingMaths.cpp"
 #include "renderer/pipeline/signals/src/Signals.cpp"
+#include "renderer/pipeline/signals/src/SignalProgram.cpp"
 #include "renderer/pipeline/signals/src/SignalSamplers.cpp"
 #include "renderer/pipeline/signals/src/accumulators/Accumulators.cpp"
 #include "renderer/pipeline/patterns/src/base/UVPattern.cpp"
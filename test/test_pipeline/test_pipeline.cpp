@@ -48,6 +48,7 @@
 #include "renderer/pipeline/maths/src/TimeMaths.cpp"
 #include "renderer/pipeline/maths/src/TilingMaths.cpp"
 #include "renderer/pipeline/signals/src/Signals.cpp"
+#include "renderer/pipeline/signals/src/SignalProgram.cpp"
 #include "renderer/pipeline/signals/src/SignalSamplers.cpp"
 #include "renderer/pipeline/signals/src/accumulators/Accumulators.cpp"
 #include "renderer/pipeline/patterns/src/Patterns.cpp"
@@ -60,6 +61,7 @@
 #include "renderer/pipeline/patterns/src/SpiralPattern.cpp"
 #include "renderer/pipeline/patterns/src/TilingPattern.cpp"
 #include "renderer/pipeline/patterns/src/TransportPattern.cpp"
+#include "renderer/pipeline/patterns/src/GrayScott.cpp"
 #include "renderer/pipeline/patterns/src/ReactionDiffusionPattern.cpp"
 #include "renderer/pipeline/patterns/src/ConwayPattern.cpp"
 #include "renderer/pipeline/patterns/src/CyclicCAPattern.cpp"
@@ -225,6 +227,156 @@ void test_scene_manager_lifecycle() {
     TEST_ASSERT_EQUAL_INT(2, provider_call_count);
 }
 
+void test_scene_manager_prefetches_next_scene() {
+    provider_call_count = 0;
+    auto provider = std::make_unique<TrackingSceneProvider>();
+    SceneManager manager(std::move(provider));
+
+    // t=0: First scene is fetched synchronously (count=1).
+    manager.advanceFrame(0);
+    TEST_ASSERT_EQUAL_INT(1, provider_call_count);
+
+    // Idle slot inside the lead window: successor is fetched ahead (count=2).
+    TEST_ASSERT_TRUE(manager.prefetchNextScene(50));
+    TEST_ASSERT_EQUAL_INT(2, provider_call_count);
+
+    // Already prefetched: further idle slots do nothing.
+    TEST_ASSERT_FALSE(manager.prefetchNextScene(60));
+    TEST_ASSERT_EQUAL_INT(2, provider_call_count);
+
+    // t=101: Expired. The prefetched scene is swapped in without asking the
+    // provider again.
+    manager.advanceFrame(101);
+    TEST_ASSERT_EQUAL_INT(2, provider_call_count);
+
+    // The swapped-in scene can prefetch its own successor.
+    TEST_ASSERT_TRUE(manager.prefetchNextScene(150));
+    TEST_ASSERT_EQUAL_INT(3, provider_call_count);
+}
+
+namespace {
+    class FullIntensityPattern : public UVPattern {
+    public:
+        UVMap layer(const std::shared_ptr<PipelineContext> &) const override {
+            return [](UV) { return PatternNormU0x16(0xFFFFu); };
+        }
+    };
+}
+
+class AlternatingLitSceneProvider : public SceneProvider {
+    bool lit{true};
+
+public:
+    std::unique_ptr<Scene> nextScene() override {
+        // Unlit scenes composite a fully transparent layer, so they render black.
+        auto l = std::make_shared<Layer>(
+            LayerBuilder(std::make_unique<FullIntensityPattern>(), CloudColors_p, "Alternating")
+                .setAlpha(u0x16(lit ? 0xFFFFu : 0u))
+                .build()
+        );
+        lit = !lit;
+        return std::make_unique<Scene>(fl::vector<std::shared_ptr<Layer>>{l}, 100);
+    }
+};
+
+void test_scene_manager_transitions_between_scenes() {
+    SceneManager manager(std::make_unique<AlternatingLitSceneProvider>());
+    manager.setTransition(SceneTransition{SceneTransitionType::RadialWipe, 40});
+
+    // Centre, rim and a spread of points in between, so one span straddles the front.
+    RenderPoint points[40];
+    for (uint16_t i = 0; i < 40; ++i) {
+        points[i] = RenderPoint{u0x16(static_cast<uint16_t>(i * 1637u)), u0x16(static_cast<uint16_t>(i * 1680u)), {}};
+    }
+    points[39].radius = u0x16(0xFFFFu);
+    CRGB out[40];
+    auto isLit = [](const CRGB &c) { return c.r > 0; };
+
+    manager.advanceFrame(0);
+    TEST_ASSERT_FALSE(manager.isTransitioning());
+    manager.sampleSpan(0, points, nullptr, out, 40);
+    TEST_ASSERT_TRUE(isLit(out[0]));
+    TEST_ASSERT_TRUE(isLit(out[39]));
+
+    // Expiry starts the wipe, still showing only the outgoing (lit) scene.
+    manager.advanceFrame(100);
+    TEST_ASSERT_TRUE(manager.isTransitioning());
+    manager.sampleSpan(0, points, nullptr, out, 40);
+    TEST_ASSERT_TRUE(isLit(out[0]));
+    TEST_ASSERT_TRUE(isLit(out[39]));
+
+    // Halfway: the incoming (unlit) scene has reached the centre but not the rim.
+    manager.advanceFrame(120);
+    manager.sampleSpan(0, points, nullptr, out, 40);
+    TEST_ASSERT_FALSE(isLit(out[0]));
+    TEST_ASSERT_TRUE(isLit(out[39]));
+    for (uint16_t i = 0; i < 40; ++i) {
+        TEST_ASSERT_EQUAL_UINT8(out[i].r, manager.sample(0, points[i]).r);
+    }
+
+    manager.advanceFrame(140);
+    TEST_ASSERT_FALSE(manager.isTransitioning());
+    manager.sampleSpan(0, points, nullptr, out, 40);
+    TEST_ASSERT_FALSE(isLit(out[39]));
+
+    // A crossfade fades every pixel in together.
+    manager.setTransition(SceneTransition{SceneTransitionType::Crossfade, 40});
+    manager.advanceFrame(200);
+    manager.sampleSpan(0, points, nullptr, out, 40);
+    TEST_ASSERT_FALSE(isLit(out[0]));
+    TEST_ASSERT_FALSE(isLit(out[39]));
+    manager.advanceFrame(220);
+    manager.sampleSpan(0, points, nullptr, out, 40);
+    TEST_ASSERT_TRUE(isLit(out[0]));
+    TEST_ASSERT_TRUE(isLit(out[39]));
+}
+
+namespace {
+    int sampler_compile_count = 0;
+
+    class CompileCountingPattern : public UVPattern {
+        bool perCore;
+
+    public:
+        explicit CompileCountingPattern(bool perCore) : perCore(perCore) {}
+
+        UVMap layer(const std::shared_ptr<PipelineContext> &) const override {
+            sampler_compile_count++;
+            return [](UV) { return PatternNormU0x16(0x8000u); };
+        }
+
+        bool needsPerCoreSampler() const override { return perCore; }
+    };
+}
+
+void test_scene_compiles_shared_sampler_once() {
+    auto shared = std::make_shared<Layer>(
+        LayerBuilder(std::make_unique<CompileCountingPattern>(false), CloudColors_p, "Shared").build()
+    );
+    auto perCore = std::make_shared<Layer>(
+        LayerBuilder(std::make_unique<CompileCountingPattern>(true), CloudColors_p, "PerCore").build()
+    );
+
+    sampler_compile_count = 0;
+    Scene sharedScene(fl::vector<std::shared_ptr<Layer>>{shared});
+    sharedScene.compile();
+    TEST_ASSERT_EQUAL_INT(1, sampler_compile_count);
+
+    // A single sampling core never needs a second chain.
+    sampler_compile_count = 0;
+    Scene perCoreScene(fl::vector<std::shared_ptr<Layer>>{perCore});
+    perCoreScene.compile(RasterDisplayInfo{}, 1);
+    TEST_ASSERT_EQUAL_INT(1, sampler_compile_count);
+
+    sampler_compile_count = 0;
+    perCoreScene.compile(RasterDisplayInfo{}, 2);
+    TEST_ASSERT_EQUAL_INT(2, sampler_compile_count);
+
+    RenderPoint point{u0x16(0x1234u), u0x16(0x4000u), {}};
+    TEST_ASSERT_EQUAL_UINT8(sharedScene.sample(0, point).r, sharedScene.sample(1, point).r);
+    TEST_ASSERT_EQUAL_UINT8(perCoreScene.sample(0, point).r, perCoreScene.sample(1, point).r);
+}
+
 void test_palette_glow_pattern_emits_rgb_samples() {
     PaletteGlowPattern pattern;
     auto context = std::make_shared<PipelineContext>();
@@ -474,6 +626,38 @@ void test_requested_rgb_pattern_signals_change_output() {
     TEST_ASSERT_TRUE(hasDifferentRgb(starFieldDefault.uvLayer(context), starFieldDark.uvLayer(context)));
 }
 
+void test_iteration_heavy_rgb_patterns_follow_render_quality() {
+    auto full = std::make_shared<PipelineContext>();
+    full->rasterDisplay = RasterDisplayInfo{true, 128, 64, 128u * 64u};
+    auto reduced = std::make_shared<PipelineContext>(*full);
+    reduced->quality = u0x16(8192);
+
+    RocaillePattern rocailleFull, rocailleReduced;
+    OctgramsPattern octgramsFull, octgramsReduced;
+    RotatingSquaresPattern squaresFull, squaresReduced;
+    StarryPlanesPattern starryFull, starryReduced;
+    UVPattern *fullPatterns[] = {&rocailleFull, &octgramsFull, &squaresFull, &starryFull};
+    UVPattern *reducedPatterns[] = {&rocailleReduced, &octgramsReduced, &squaresReduced, &starryReduced};
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        fullPatterns[i]->setContext(full);
+        reducedPatterns[i]->setContext(reduced);
+        fullPatterns[i]->advanceFrame(u0x16(0), 1000);
+        reducedPatterns[i]->advanceFrame(u0x16(0), 1000);
+        UVLayer fullLayer = fullPatterns[i]->uvLayer(full);
+        UVLayer reducedLayer = reducedPatterns[i]->uvLayer(reduced);
+        TEST_ASSERT_TRUE(hasVisibleRgb(reducedLayer));
+        uint16_t differing = 0;
+        for (uint32_t y = 0; y < 16; ++y) {
+            for (uint32_t x = 0; x < 16; ++x) {
+                UV probe(fl::s16x16::from_raw(static_cast<int32_t>(x << 12)), fl::s16x16::from_raw(static_cast<int32_t>(y << 12)));
+                if (fullLayer.rgb(probe).packed != reducedLayer.rgb(probe).packed) ++differing;
+            }
+        }
+        TEST_ASSERT_TRUE(differing > 0);
+    }
+}
+
 void test_star_field_travel_new_planes_fade_in() {
     TEST_ASSERT_EQUAL_UINT32(0u, starFieldTravelBirthFadeRaw(S0X16_ONE));
     TEST_ASSERT_LESS_THAN_UINT32(S0X16_ONE / 8, starFieldTravelBirthFadeRaw(S0X16_ONE - Q16_0_01));
@@ -863,6 +1047,193 @@ void test_conway_invalid_and_over_capacity_raster_render_black() {
     TEST_ASSERT_EQUAL_UINT16(0, raw(capacityMap(rasterPoint(0, 0, 65, 64))));
 }
 
+namespace {
+    // Raster automaton whose step flips cell (1, 1), so only row 1 changes.
+    // Step number `flipRowTwoAt` also flips cell (1, 2).
+    class RowFlipPattern : public RasterAutomaton {
+    public:
+        mutable uint32_t samples{0};
+        uint32_t flipRowTwoAt{0};
+
+        RowFlipPattern() : RasterAutomaton(100, 1) {}
+
+        RasterMap rasterLayer(const std::shared_ptr<PipelineContext> &context) const override {
+            configure(context);
+            return [this](const RasterPoint &point) {
+                ++samples;
+                const uint32_t idx = static_cast<uint32_t>(point.y) * width() + point.x;
+                return PatternNormU0x16(static_cast<uint16_t>(cells[idx] * 0x4000u));
+            };
+        }
+
+    protected:
+        bool allocate(uint16_t, uint16_t, uint32_t count) const override {
+            cells.reset(new uint8_t[count]);
+            next.reset(new uint8_t[count]);
+            return true;
+        }
+
+        void release() const override {
+            cells.reset();
+            next.reset();
+        }
+
+        void seed(uint32_t) const override {
+            for (uint32_t i = 0; i < cellCount(); ++i) cells[i] = static_cast<uint8_t>(i % 4u);
+        }
+
+        bool step() const override {
+            for (uint32_t i = 0; i < cellCount(); ++i) next[i] = cells[i];
+            const uint32_t flipped = width() + 1u;
+            next[flipped] = static_cast<uint8_t>(3u - next[flipped]);
+            if (++steps == flipRowTwoAt) {
+                const uint32_t rowTwo = 2u * width() + 1u;
+                next[rowTwo] = static_cast<uint8_t>(3u - next[rowTwo]);
+            }
+            markChangedRows(cells.get(), next.get());
+            cells.swap(next);
+            return true;
+        }
+
+    private:
+        mutable uint32_t steps{0};
+        mutable std::unique_ptr<uint8_t[]> cells;
+        mutable std::unique_ptr<uint8_t[]> next;
+    };
+}
+
+void test_raster_layer_resamples_only_changed_rows() {
+    constexpr uint16_t W = 4;
+    constexpr uint16_t H = 4;
+    auto pattern = std::make_unique<RowFlipPattern>();
+    const RowFlipPattern *probe = pattern.get();
+    Layer layer = LayerBuilder(std::move(pattern), CloudColors_p, "row-flip").build();
+    layer.setRasterDisplayInfo(RasterDisplayInfo{true, W, H, W * H});
+    auto span = layer.compileSpan();
+
+    RenderPoint points[W * H];
+    for (uint16_t i = 0; i < W * H; ++i) {
+        points[i].raster = rasterPoint(static_cast<uint16_t>(i % W), static_cast<uint16_t>(i / W), W, H);
+    }
+    CRGB first[W * H];
+    CRGB out[W * H];
+
+    (*span)(points, nullptr, first, W * H);
+    TEST_ASSERT_EQUAL_UINT32(W * H, probe->samples);
+
+    // Between steps the board is unchanged: nothing is sampled again. Native
+    // tint renders the scalar as grey, so the red channel suffices.
+    layer.advanceFrame(u0x16(0), 0);
+    layer.advanceFrame(u0x16(0), 50);
+    (*span)(points, nullptr, out, W * H);
+    TEST_ASSERT_EQUAL_UINT32(W * H, probe->samples);
+    for (uint16_t i = 0; i < W * H; ++i) TEST_ASSERT_EQUAL_UINT8(first[i].r, out[i].r);
+
+    // One step changes row 1 only; its four cells are resampled.
+    layer.advanceFrame(u0x16(0), 100);
+    (*span)(points, nullptr, out, W * H);
+    TEST_ASSERT_EQUAL_UINT32(W * H + W, probe->samples);
+    TEST_ASSERT_TRUE(out[W + 1].r != first[W + 1].r);
+
+    // A fresh sampler (no cache) agrees with the cached output.
+    auto fresh = layer.compileSpan();
+    CRGB expected[W * H];
+    (*fresh)(points, nullptr, expected, W * H);
+    for (uint16_t i = 0; i < W * H; ++i) TEST_ASSERT_EQUAL_UINT8(expected[i].r, out[i].r);
+}
+
+void test_raster_layer_resamples_row_changed_after_256_generations() {
+    constexpr uint16_t W = 4;
+    constexpr uint16_t H = 4;
+    auto pattern = std::make_unique<RowFlipPattern>();
+    pattern->flipRowTwoAt = 256;
+    Layer layer = LayerBuilder(std::move(pattern), CloudColors_p, "row-flip-256").build();
+    layer.setRasterDisplayInfo(RasterDisplayInfo{true, W, H, W * H});
+    auto span = layer.compileSpan();
+
+    RenderPoint points[W * H];
+    for (uint16_t i = 0; i < W * H; ++i) {
+        points[i].raster = rasterPoint(static_cast<uint16_t>(i % W), static_cast<uint16_t>(i / W), W, H);
+    }
+    CRGB first[W * H];
+    CRGB out[W * H];
+
+    layer.advanceFrame(u0x16(0), 0);
+    (*span)(points, nullptr, first, W * H);
+
+    // Row 2 stays unchanged while every cell is visited each generation, then
+    // changes exactly 256 generations after it was last stamped.
+    for (uint32_t step = 1; step <= 256; ++step) {
+        layer.advanceFrame(u0x16(0), step * 100u);
+        (*span)(points, nullptr, out, W * H);
+    }
+    TEST_ASSERT_TRUE(out[2 * W + 1].r != first[2 * W + 1].r);
+
+    auto fresh = layer.compileSpan();
+    CRGB expected[W * H];
+    (*fresh)(points, nullptr, expected, W * H);
+    for (uint16_t i = 0; i < W * H; ++i) TEST_ASSERT_EQUAL_UINT8(expected[i].r, out[i].r);
+}
+
+namespace {
+    // Time-sliced automaton with two stages per step that only counts the
+    // rows it is asked to compute.
+    class SlicedCountingPattern : public RasterAutomaton {
+    public:
+        mutable uint32_t rowsStepped{0};
+        mutable uint32_t stagesFinished{0};
+
+        SlicedCountingPattern() : RasterAutomaton(100, 1, true) {}
+
+        RasterMap rasterLayer(const std::shared_ptr<PipelineContext> &context) const override {
+            configure(context);
+            return [](const RasterPoint &) { return PatternNormU0x16(0); };
+        }
+
+    protected:
+        bool allocate(uint16_t, uint16_t, uint32_t) const override { return true; }
+        void release() const override {}
+        void seed(uint32_t) const override {}
+        bool step() const override { return true; }
+        uint16_t stepStages() const override { return 2; }
+
+        void stepRows(uint16_t, uint16_t firstRow, uint16_t endRow) const override {
+            rowsStepped += endRow - firstRow;
+        }
+
+        bool finishStage(uint16_t) const override {
+            ++stagesFinished;
+            return true;
+        }
+    };
+}
+
+void test_time_sliced_automaton_spreads_rows_across_frames() {
+    SlicedCountingPattern pattern;
+    (void) pattern.rasterLayer(rasterContext(4, 8));
+    const uint32_t seeded = pattern.rasterChanges()->generation;
+
+    // A step is 2 stages x 8 rows over 100 ms: 25 ms earns 4 rows.
+    pattern.advanceFrame(u0x16(0), 0);
+    pattern.advanceFrame(u0x16(0), 25);
+    TEST_ASSERT_EQUAL_UINT32(4, pattern.rowsStepped);
+    TEST_ASSERT_EQUAL_UINT32(0, pattern.stagesFinished);
+    TEST_ASSERT_EQUAL_UINT32(seeded, pattern.rasterChanges()->generation);
+
+    // Finishing the first stage publishes a generation.
+    pattern.advanceFrame(u0x16(0), 50);
+    TEST_ASSERT_EQUAL_UINT32(8, pattern.rowsStepped);
+    TEST_ASSERT_EQUAL_UINT32(1, pattern.stagesFinished);
+    TEST_ASSERT_EQUAL_UINT32(seeded + 1u, pattern.rasterChanges()->generation);
+
+    // A long frame works off at most one step's rows; the rest is carried.
+    pattern.advanceFrame(u0x16(0), 450);
+    TEST_ASSERT_EQUAL_UINT32(24, pattern.rowsStepped);
+    pattern.advanceFrame(u0x16(0), 460);
+    TEST_ASSERT_EQUAL_UINT32(40, pattern.rowsStepped);
+    TEST_ASSERT_EQUAL_UINT32(5, pattern.stagesFinished);
+}
+
 void test_display_specs_report_raster_points() {
     TestMatrixSpec matrix(3, 2);
     RenderPoint matrixPoint = matrix.toRenderPoint(4);
@@ -924,6 +1295,163 @@ void test_raster_moore_neighbourhood_wraps() {
     TEST_ASSERT_EQUAL_UINT8(3, raster::countMooreState(grid, 0, 0, 3, 3, 5));
 }
 
+void test_packed_life_step_matches_byte_reference() {
+    // Widths that end mid-word and on a word boundary, so both wrap paths run.
+    const uint16_t widths[] = {37, 64};
+    const uint16_t H = 6;
+    for (uint16_t W: widths) {
+        const uint16_t words = raster::packedWordsPerRow(W);
+        uint8_t bytes[64 * H];
+        uint8_t expected[64 * H];
+        uint32_t packed[2 * H];
+        uint32_t packedNext[2 * H] = {};
+        for (uint32_t i = 0; i < 2u * H; ++i) packed[i] = 0u;
+
+        uint32_t rng = 0x1234u + W;
+        for (uint16_t y = 0; y < H; ++y) {
+            for (uint16_t x = 0; x < W; ++x) {
+                const bool alive = ((raster::lcgNext(rng) >> 16) % 1000u) < 400u;
+                bytes[y * W + x] = alive ? 1u : 0u;
+                raster::setPackedCell(packed, words, x, y, alive);
+            }
+        }
+
+        ConwayPattern::stepCells(bytes, expected, W, H);
+        raster::stepLifePacked(packed, packedNext, W, H, 1u << 3, (1u << 2) | (1u << 3), 0, H);
+        for (uint16_t y = 0; y < H; ++y) {
+            for (uint16_t x = 0; x < W; ++x) {
+                TEST_ASSERT_EQUAL_UINT8(expected[y * W + x], raster::packedCell(packedNext, words, x, y) ? 1u : 0u);
+            }
+            // Padding past the last column stays clear.
+            if (W & 31u) TEST_ASSERT_EQUAL_UINT32(0u, packedNext[y * words + words - 1u] >> (W & 31u));
+        }
+
+        // Rule 30 on the first row, against the per-cell triple lookup.
+        uint32_t rowNext[2] = {};
+        raster::stepElementaryPacked(packed, rowNext, W, 30);
+        for (uint16_t x = 0; x < W; ++x) {
+            const uint16_t xLeft = x == 0 ? static_cast<uint16_t>(W - 1) : static_cast<uint16_t>(x - 1);
+            const uint16_t xRight = x == W - 1 ? 0 : static_cast<uint16_t>(x + 1);
+            const uint8_t triple = static_cast<uint8_t>((bytes[xLeft] << 2) | (bytes[x] << 1) | bytes[xRight]);
+            TEST_ASSERT_EQUAL_UINT8((30u >> triple) & 1u, raster::packedCell(rowNext, words, x, 0) ? 1u : 0u);
+        }
+    }
+}
+
+void test_gray_scott_row_kernel_matches_per_cell_reference() {
+    // Narrow grids make every cell a border cell; wider ones run the interior loop.
+    const uint16_t sizes[][2] = {{1, 1}, {2, 3}, {7, 5}, {20, 20}};
+    const grayscott::Params p{13107, 6554, 3604, 4063};
+    for (const auto &size: sizes) {
+        const uint16_t W = size[0];
+        const uint16_t H = size[1];
+        uint16_t u[400], v[400], uOut[400], vOut[400];
+        uint32_t rng = 0xBEEFu + W;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(W) * H; ++i) {
+            u[i] = static_cast<uint16_t>(raster::lcgNext(rng) >> 16);
+            v[i] = static_cast<uint16_t>(raster::lcgNext(rng) >> 16);
+        }
+        // Saturated extremes exercise the largest Laplacians and both clamps.
+        u[0] = 65535u;
+        v[0] = 0u;
+        if (W * H > 1) {
+            u[1] = 0u;
+            v[1] = 65535u;
+        }
+
+        grayscott::stepRows(u, v, uOut, vOut, W, H, 0, H, p);
+        for (uint16_t y = 0; y < H; ++y) {
+            for (uint16_t x = 0; x < W; ++x) {
+                const uint32_t row = static_cast<uint32_t>(y) * W;
+                const uint32_t il = row + (x == 0 ? W - 1 : x - 1);
+                const uint32_t ir = row + (x == W - 1 ? 0 : x + 1);
+                const uint32_t iu = x + static_cast<uint32_t>(y == 0 ? H - 1 : y - 1) * W;
+                const uint32_t id = x + static_cast<uint32_t>(y == H - 1 ? 0 : y + 1) * W;
+                const int32_t uu = u[row + x];
+                const int32_t vv = v[row + x];
+                const int32_t lapU = static_cast<int32_t>(u[il]) + u[ir] + u[iu] + u[id] - 4 * uu;
+                const int32_t lapV = static_cast<int32_t>(v[il]) + v[ir] + v[iu] + v[id] - 4 * vv;
+                const int32_t uv = static_cast<int32_t>((static_cast<uint64_t>(uu) * static_cast<uint64_t>(vv)) >> 16);
+                const int32_t uv2 = static_cast<int32_t>((static_cast<uint64_t>(uv) * static_cast<uint64_t>(vv)) >> 16);
+                const int32_t newU = uu + static_cast<int32_t>((static_cast<int64_t>(p.du) * lapU) >> 16) - uv2 +
+                                     static_cast<int32_t>((p.f * static_cast<uint32_t>(65536 - uu)) >> 16);
+                const int32_t newV = vv + static_cast<int32_t>((static_cast<int64_t>(p.dv) * lapV) >> 16) + uv2 -
+                                     static_cast<int32_t>(((p.f + p.k) * static_cast<uint32_t>(vv)) >> 16);
+                TEST_ASSERT_EQUAL_UINT16(std::min(std::max(newU, 0), 65535), uOut[row + x]);
+                TEST_ASSERT_EQUAL_UINT16(std::min(std::max(newV, 0), 65535), vOut[row + x]);
+            }
+        }
+    }
+}
+
+void test_transport_polar_table_advection_matches_per_cell_reference() {
+    // Odd and even sizes put the centre on and between cells.
+    const uint8_t sizes[] = {17, 32};
+    for (uint8_t g: sizes) {
+        const size_t n = static_cast<size_t>(g) * g;
+        static uint16_t source[32 * 32], dest[32 * 32];
+        static PolarCoord table[32 * 32];
+        uint32_t rng = 0x5EEDu + g;
+        for (size_t i = 0; i < n; ++i) source[i] = static_cast<uint16_t>(raster::lcgNext(rng) >> 16);
+        buildPolarTable(table, g);
+
+        TransportParams p{};
+        p.gridSize = g;
+        p.radialSpeedRaw = 3 << 14;
+        p.angularSpeedRaw = 1 << 12;
+        const u0x16 fade(60000u);
+        grid::advectGrid2DBackward(source, dest, g, TransportField<TransportMode::SpiralInward>{table, &p}, fade);
+
+        for (uint8_t y = 0; y < g; ++y) {
+            for (uint8_t x = 0; x < g; ++x) {
+                // Geometry recomputed per cell, as the uncached loop did.
+                const Vec2I32 disp = polarToCartesian(gridToPolar(x, y, g), -p.radialSpeedRaw, p.angularSpeedRaw);
+                const int32_t srcX = (static_cast<int32_t>(x) << 16) + (1 << 15) - disp.x;
+                const int32_t srcY = (static_cast<int32_t>(y) << 16) + (1 << 15) - disp.y;
+                const uint16_t expected = scaleU16ByU0x16(
+                    grid::sampleGridBilinearWrapped(source, g, srcX, srcY), fade);
+                TEST_ASSERT_EQUAL_UINT16(expected, dest[static_cast<size_t>(y) * g + x]);
+            }
+        }
+    }
+}
+
+void test_lane_advection_matches_per_cell_reference() {
+    // Shifts of both signs, past a whole cell and past the lane length.
+    const uint8_t sizes[] = {5, 32};
+    const int32_t shifts[] = {0, 40000, -40000, 3 * 65536 + 123, -(70 << 16) - 9};
+    for (uint8_t g: sizes) {
+        const size_t n = static_cast<size_t>(g) * g;
+        static uint16_t cells[32 * 32], rowPass[32 * 32], source[32 * 32], expectedRows[32 * 32];
+        uint32_t rng = 0xA11Eu + g;
+        for (size_t i = 0; i < n; ++i) source[i] = cells[i] = static_cast<uint16_t>(raster::lcgNext(rng) >> 16);
+        const u0x16 fade(50000u);
+        auto shiftAt = [&shifts](uint8_t lane) { return fl::s16x16::from_raw(shifts[lane % 5]); };
+        grid::advectLanesWrapped(cells, rowPass, g, shiftAt, [&](uint8_t x) { return shiftAt(x + 2); }, fade);
+
+        // dest[d] = lerp(src[floor(d - shift)], src[floor(d - shift) + 1]), wrapped with modulo.
+        auto sampleLane = [g](const uint16_t *lane, size_t stride, uint8_t d, int32_t shiftRaw) {
+            const int32_t span = static_cast<int32_t>(g) << 16;
+            int32_t coord = ((static_cast<int32_t>(d) << 16) - shiftRaw) % span;
+            if (coord < 0) coord += span;
+            const uint8_t lower = static_cast<uint8_t>(coord >> 16);
+            const uint8_t upper = static_cast<uint8_t>((lower + 1u) % g);
+            return lerpU16ByQ16(lane[lower * stride], lane[upper * stride], u0x16(static_cast<uint16_t>(coord & 0xFFFF)));
+        };
+        for (uint8_t y = 0; y < g; ++y) {
+            for (uint8_t x = 0; x < g; ++x) {
+                expectedRows[y * g + x] = sampleLane(source + y * g, 1, x, shifts[y % 5]);
+            }
+        }
+        for (uint8_t x = 0; x < g; ++x) {
+            for (uint8_t y = 0; y < g; ++y) {
+                const uint16_t expected = scaleU16ByU0x16(sampleLane(expectedRows + x, g, y, shifts[(x + 2) % 5]), fade);
+                TEST_ASSERT_EQUAL_UINT16(expected, cells[y * g + x]);
+            }
+        }
+    }
+}
+
 void test_cyclic_ca_step_advances_on_threshold() {
     const uint16_t W = 8;
     const uint16_t H = 8;
@@ -1391,6 +1919,9 @@ void setup() {
     RUN_TEST(test_range_wraps_across_zero);
     RUN_TEST(test_scene_progress_calculation);
     RUN_TEST(test_scene_manager_lifecycle);
+    RUN_TEST(test_scene_manager_prefetches_next_scene);
+    RUN_TEST(test_scene_manager_transitions_between_scenes);
+    RUN_TEST(test_scene_compiles_shared_sampler_once);
     RUN_TEST(test_palette_glow_pattern_emits_rgb_samples);
     RUN_TEST(test_palette_glow_speed_signal_scales_elapsed_time);
     RUN_TEST(test_palette_glow_tile_scale_signal_changes_loop_scale);
@@ -1404,7 +1935,14 @@ void setup() {
     RUN_TEST(test_conway_reseeds_when_static);
     RUN_TEST(test_conway_colour_survives_and_births_inherit);
     RUN_TEST(test_conway_invalid_and_over_capacity_raster_render_black);
+    RUN_TEST(test_raster_layer_resamples_only_changed_rows);
+    RUN_TEST(test_raster_layer_resamples_row_changed_after_256_generations);
+    RUN_TEST(test_time_sliced_automaton_spreads_rows_across_frames);
     RUN_TEST(test_raster_moore_neighbourhood_wraps);
+    RUN_TEST(test_packed_life_step_matches_byte_reference);
+    RUN_TEST(test_gray_scott_row_kernel_matches_per_cell_reference);
+    RUN_TEST(test_transport_polar_table_advection_matches_per_cell_reference);
+    RUN_TEST(test_lane_advection_matches_per_cell_reference);
     RUN_TEST(test_cyclic_ca_step_advances_on_threshold);
     RUN_TEST(test_cyclic_ca_is_deterministic);
     RUN_TEST(test_brians_brain_cycles_firing_to_dying_to_off);
@@ -1439,12 +1977,16 @@ int main(int argc, char **argv) {
     RUN_TEST(test_range_wraps_across_zero);
     RUN_TEST(test_scene_progress_calculation);
     RUN_TEST(test_scene_manager_lifecycle);
+    RUN_TEST(test_scene_manager_prefetches_next_scene);
+    RUN_TEST(test_scene_manager_transitions_between_scenes);
+    RUN_TEST(test_scene_compiles_shared_sampler_once);
     RUN_TEST(test_palette_glow_pattern_emits_rgb_samples);
     RUN_TEST(test_palette_glow_pattern_matches_shadertoy_reference_points);
     RUN_TEST(test_palette_glow_speed_signal_scales_elapsed_time);
     RUN_TEST(test_palette_glow_tile_scale_signal_changes_loop_scale);
     RUN_TEST(test_requested_rgb_patterns_emit_rgb_samples);
     RUN_TEST(test_requested_rgb_pattern_signals_change_output);
+    RUN_TEST(test_iteration_heavy_rgb_patterns_follow_render_quality);
     RUN_TEST(test_star_field_travel_new_planes_fade_in);
     RUN_TEST(test_reaction_diffusion_compiled_sampler_tracks_front_buffer);
     RUN_TEST(test_conway_step_rules);
@@ -1456,7 +1998,14 @@ int main(int argc, char **argv) {
     RUN_TEST(test_conway_reseeds_when_static);
     RUN_TEST(test_conway_colour_survives_and_births_inherit);
     RUN_TEST(test_conway_invalid_and_over_capacity_raster_render_black);
+    RUN_TEST(test_raster_layer_resamples_only_changed_rows);
+    RUN_TEST(test_raster_layer_resamples_row_changed_after_256_generations);
+    RUN_TEST(test_time_sliced_automaton_spreads_rows_across_frames);
     RUN_TEST(test_raster_moore_neighbourhood_wraps);
+    RUN_TEST(test_packed_life_step_matches_byte_reference);
+    RUN_TEST(test_gray_scott_row_kernel_matches_per_cell_reference);
+    RUN_TEST(test_transport_polar_table_advection_matches_per_cell_reference);
+    RUN_TEST(test_lane_advection_matches_per_cell_reference);
     RUN_TEST(test_cyclic_ca_step_advances_on_threshold);
     RUN_TEST(test_cyclic_ca_is_deterministic);
     RUN_TEST(test_brians_brain_cycles_firing_to_dying_to_off);
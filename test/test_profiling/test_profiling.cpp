@@ -0,0 +1,263 @@
+//  SPDX-License-Identifier: GPL-3.0-or-later
+//  Copyright (C) 2025 Pierre Thomain
+
+/*
+ * This file is part of PolarShader.
+ *
+ * PolarShader is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PolarShader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PolarShader. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Profiled build: the profiler and op-count hooks only exist with these set.
+#define POLAR_SHADER_PROFILE 1
+#define POLAR_SHADER_COUNT_OPS 1
+
+#include "renderer/pipeline/signals/Signals.h"
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include "native/Arduino.h"
+#include "native/FastLED.h"
+#endif
+#include <unity.h>
+#include "renderer/pipeline/signals/SignalTypes.h"
+#include "renderer/pipeline/maths/units/Units.h"
+#include "renderer/pipeline/maths/PolarMaths.h"
+#include "renderer/pipeline/transforms/RotationTransform.h"
+#include "renderer/layer/LayerBuilder.h"
+#include "renderer/scene/Scene.h"
+#include "renderer/PolarRenderer.h"
+#define private public
+#include "renderer/pipeline/patterns/NoisePattern.h"
+#undef private
+
+#ifndef ARDUINO
+#include "renderer/pipeline/maths/src/PolarMaths.cpp"
+#include "renderer/pipeline/maths/src/NoiseMaths.cpp"
+#include "renderer/pipeline/maths/src/PatternMaths.cpp"
+#include "renderer/pipeline/maths/src/TimeMaths.cpp"
+#include "renderer/pipeline/maths/src/TilingMaths.cpp"
+#include "renderer/pipeline/transforms/src/KaleidoscopeTransform.cpp"
+#include "renderer/pipeline/transforms/src/RotationTransform.cpp"
+#include "renderer/pipeline/transforms/src/TranslationTransform.cpp"
+#include "renderer/pipeline/transforms/src/ZoomTransform.cpp"
+#include "renderer/pipeline/transforms/src/FlowFieldTransform.cpp"
+#include "renderer/pipeline/transforms/src/PaletteTransform.cpp"
+#include "renderer/pipeline/transforms/src/RadialKaleidoscopeTransform.cpp"
+#include "renderer/pipeline/transforms/src/TilingTransform.cpp"
+#include "renderer/pipeline/transforms/src/VortexTransform.cpp"
+#include "renderer/pipeline/signals/src/Signals.cpp"
+#include "renderer/pipeline/signals/src/SignalProgram.cpp"
+#include "renderer/pipeline/signals/src/SignalSamplers.cpp"
+#include "renderer/pipeline/signals/src/accumulators/Accumulators.cpp"
+#include "renderer/pipeline/patterns/src/Patterns.cpp"
+#include "renderer/pipeline/patterns/src/AnnuliPattern.cpp"
+#include "renderer/pipeline/patterns/src/base/RasterAutomaton.cpp"
+#include "renderer/pipeline/patterns/src/ConwayPattern.cpp"
+#include "renderer/pipeline/patterns/src/CyclicCAPattern.cpp"
+#include "renderer/pipeline/patterns/src/BriansBrainPattern.cpp"
+#include "renderer/pipeline/patterns/src/LifeVariantPattern.cpp"
+#include "renderer/pipeline/patterns/src/ElementaryCAPattern.cpp"
+#include "renderer/pipeline/patterns/src/MatrixRainPattern.cpp"
+#include "renderer/pipeline/patterns/src/RipplePattern.cpp"
+#include "renderer/pipeline/patterns/src/ForestFirePattern.cpp"
+#include "renderer/pipeline/patterns/src/WireWorldPattern.cpp"
+#include "renderer/pipeline/patterns/src/LangtonAntPattern.cpp"
+#include "renderer/pipeline/patterns/src/RasterReactionDiffusionPattern.cpp"
+#include "renderer/pipeline/patterns/src/FlowFieldPattern.cpp"
+#include "renderer/pipeline/patterns/src/FlurryPattern.cpp"
+#include "renderer/pipeline/patterns/src/PaletteGlowPattern.cpp"
+#include "renderer/pipeline/patterns/src/ShaderToyRgbPatterns.cpp"
+#include "renderer/pipeline/patterns/src/NoisePattern.cpp"
+#include "renderer/pipeline/patterns/src/SpiralPattern.cpp"
+#include "renderer/pipeline/patterns/src/TilingPattern.cpp"
+#include "renderer/pipeline/patterns/src/TransportPattern.cpp"
+#include "renderer/pipeline/patterns/src/GrayScott.cpp"
+#include "renderer/pipeline/patterns/src/ReactionDiffusionPattern.cpp"
+#include "renderer/pipeline/patterns/src/WorleyPatterns.cpp"
+#include "renderer/pipeline/patterns/src/XORPattern.cpp"
+#include "renderer/pipeline/patterns/src/base/UVPattern.cpp"
+#include "renderer/layer/src/Layer.cpp"
+#include "renderer/layer/src/LayerBuilder.cpp"
+#include "renderer/scene/src/Scene.cpp"
+#include "renderer/scene/src/SceneManager.cpp"
+#include "renderer/pipeline/presets/src/Presets.cpp"
+#include "renderer/PolarRenderer.cpp"
+#include "renderer/profiling/src/FrameProfiler.cpp"
+#include "renderer/profiling/src/CostModel.cpp"
+#include "renderer/profiling/src/QualityGovernor.cpp"
+#endif
+
+using namespace PolarShader;
+
+namespace {
+    std::unique_ptr<PolarRenderer> makeFrameSkipRenderer(uint16_t count, uint8_t frameDivisor, uint16_t depthSpeed) {
+        auto provider = std::make_unique<DefaultSceneProvider>([frameDivisor, depthSpeed]() {
+            CRGBPalette16 ramp;
+            for (uint8_t i = 0; i < 16; ++i) ramp.entries[i] = CRGB(i * 16, 255 - i * 16, 128);
+            auto pattern = std::make_unique<NoisePattern>(NoisePattern::NoiseType::Basic, 4, constant(depthSpeed));
+            pattern->state.depth = 0x12345678u;
+            fl::vector<std::shared_ptr<Layer> > layers;
+            layers.push_back(std::make_shared<Layer>(
+                LayerBuilder(std::move(pattern), ramp, "skip").setFrameDivisor(frameDivisor).build()
+            ));
+            return std::make_unique<Scene>(std::move(layers));
+        });
+        return std::make_unique<PolarRenderer>(count, [](uint16_t i) {
+            return RenderPoint{u0x16(static_cast<uint16_t>(i * 40503u)), u0x16(static_cast<uint16_t>(i * 851u)), {}};
+        }, std::move(provider));
+    }
+}
+
+void test_frame_profiler_tracks_layers_and_steps() {
+    fl::vector<std::shared_ptr<Layer> > layers;
+    layers.push_back(std::make_shared<Layer>(
+        LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "profiled")
+        .addTransform(RotationTransform(constant(s0x16(0x1000)), true))
+        .build()
+    ));
+    Scene scene(std::move(layers));
+    scene.compile();
+    FrameProfiler::reset();
+
+    RenderPoint points[40];
+    for (uint16_t i = 0; i < 40; ++i) {
+        points[i] = RenderPoint{u0x16(static_cast<uint16_t>(i * 1500u)), u0x16(static_cast<uint16_t>(i * 1600u)), {}};
+    }
+    CRGB out[40];
+    bool windowClosed = false;
+    for (uint16_t frame = 0; frame < POLAR_SHADER_PROFILE_WINDOW_FRAMES; ++frame) {
+        scene.advanceFrame(u0x16(0), frame * 16u);
+        scene.sampleSpan(0, points, nullptr, out, 40);
+        windowClosed = FrameProfiler::endFrame();
+    }
+    TEST_ASSERT_TRUE(windowClosed);
+
+    const uint16_t ids[] = {
+        FrameProfiler::componentId(ProfileStage::SceneAdvance, "scene"),
+        FrameProfiler::componentId(ProfileStage::LayerAdvance, "profiled"),
+        FrameProfiler::componentId(ProfileStage::LayerAdvance, "profiled", 0),
+        FrameProfiler::componentId(ProfileStage::LayerAdvance, "profiled", 1),
+        FrameProfiler::componentId(ProfileStage::LayerSample, "profiled"),
+        FrameProfiler::componentId(ProfileStage::Blend, "scene"),
+    };
+    for (uint16_t id: ids) {
+        TEST_ASSERT_NOT_EQUAL(FrameProfiler::NO_COMPONENT, id);
+        const ProfileStats stats = FrameProfiler::stats(id);
+        TEST_ASSERT_TRUE(stats.min <= stats.mean);
+        TEST_ASSERT_TRUE(stats.mean <= stats.max);
+    }
+    TEST_ASSERT_TRUE(FrameProfiler::stats(ids[4]).max > 0);
+
+    char report[1024];
+    FrameProfiler::formatReport(report, sizeof(report));
+    TEST_ASSERT_NOT_NULL(strstr(report, "layer.sample profiled "));
+    TEST_ASSERT_NOT_NULL(strstr(report, "layer.advance profiled#1 "));
+}
+
+void test_op_counter_splits_advance_and_render() {
+    constexpr uint16_t count = 77;
+    auto provider = std::make_unique<DefaultSceneProvider>([]() {
+        fl::vector<std::shared_ptr<Layer> > layers;
+        layers.push_back(std::make_shared<Layer>(
+            LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "counted").build()
+        ));
+        return std::make_unique<Scene>(std::move(layers));
+    });
+    PolarRenderer renderer(count, [](uint16_t i) {
+        return RenderPoint{u0x16(static_cast<uint16_t>(i * 40503u)), u0x16(static_cast<uint16_t>(i * 851u)), {}};
+    }, std::move(provider));
+
+    CRGB out[count];
+    renderer.render(out, 0);
+    OpCounter::reset();
+    renderer.render(out, 16);
+    renderer.render(out, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(2, OpCounter::frames());
+    const OpCounts render = OpCounter::counts(OpStage::Render).perFrame(OpCounter::frames());
+    // One layer, one trilinear noise sample per pixel: 4 lattice columns
+    // through the memo (misses evaluate inoise16 twice) or 8 points direct.
+    TEST_ASSERT_EQUAL_UINT32(count, static_cast<uint32_t>(render[CountedOp::LayerPixel]));
+    const uint64_t probes = render[CountedOp::NoiseProbe];
+    TEST_ASSERT_EQUAL_UINT32(0, static_cast<uint32_t>(probes % 4u));
+    TEST_ASSERT_EQUAL_UINT32(2u * (probes - render[CountedOp::NoiseHit]) + 8u * (count - probes / 4u),
+                             static_cast<uint32_t>(render[CountedOp::Noise]));
+    TEST_ASSERT_EQUAL_UINT32(0, static_cast<uint32_t>(
+        OpCounter::counts(OpStage::Advance)[CountedOp::LayerPixel]));
+}
+
+void test_adaptive_frame_skip_settles_on_maximum_divisor() {
+    constexpr uint16_t count = 77;
+    CRGB out[count];
+    // A still layer on an adaptive divisor ends up refreshing each pixel
+    // once every POLAR_SHADER_FRAME_SKIP_MAX frames.
+    auto adaptive = makeFrameSkipRenderer(count, 0, 0);
+    for (uint16_t frame = 0; frame < 40; ++frame) adaptive->render(out, frame * 30u);
+    OpCounter::reset();
+    for (uint16_t frame = 40; frame < 40 + POLAR_SHADER_FRAME_SKIP_MAX; ++frame) adaptive->render(out, frame * 30u);
+    TEST_ASSERT_EQUAL_UINT32(count, static_cast<uint32_t>(OpCounter::counts(OpStage::Render)[CountedOp::LayerPixel]));
+}
+
+void test_cost_model_predicts_frame_time() {
+    const BoardCostTable board{"test", 10000000u, {10, 0, 0, 0, 0, 20}, 2, 1000, false};
+    OpCounts advance;
+    advance[CountedOp::Mul64] = 100;  // 1000 cycles -> 100 us on one core
+    OpCounts render;
+    render[CountedOp::LayerPixel] = 1000; // 20000 cycles -> 1000 us over two cores
+
+    FramePrediction prediction = predictFrame(board, advance, render, 10);
+    TEST_ASSERT_EQUAL_UINT32(100, prediction.advanceMicros);
+    TEST_ASSERT_EQUAL_UINT32(1000, prediction.renderMicros);
+    TEST_ASSERT_EQUAL_UINT32(10, prediction.showMicros);
+    TEST_ASSERT_EQUAL_UINT32(1110, prediction.frameMicros);
+    TEST_ASSERT_EQUAL_UINT16(9009, prediction.fpsTenths);
+    TEST_ASSERT_TRUE(prediction.withinBudget);
+
+    // Overlapped output only costs what the render does not hide.
+    const BoardCostTable overlapped{"test", 10000000u, {10, 0, 0, 0, 0, 20}, 2, 1000, true};
+    TEST_ASSERT_EQUAL_UINT32(1100, predictFrame(overlapped, advance, render, 10).frameMicros);
+
+    render[CountedOp::LayerPixel] = 40000;
+    TEST_ASSERT_FALSE(predictFrame(board, advance, render, 10).withinBudget);
+
+    TEST_ASSERT_NOT_NULL(findBoardCostTable("seeed_xiao"));
+    TEST_ASSERT_NULL(findBoardCostTable("unknown"));
+    char report[256];
+    formatPredictionReport(advance, render, 10, report, sizeof(report));
+    TEST_ASSERT_NOT_NULL(strstr(report, "seeed_xiao "));
+    TEST_ASSERT_NOT_NULL(strstr(report, " over budget\n"));
+}
+
+#ifdef ARDUINO
+void setup() {
+    delay(2000);
+    UNITY_BEGIN();
+    RUN_TEST(test_frame_profiler_tracks_layers_and_steps);
+    RUN_TEST(test_op_counter_splits_advance_and_render);
+    RUN_TEST(test_adaptive_frame_skip_settles_on_maximum_divisor);
+    RUN_TEST(test_cost_model_predicts_frame_time);
+    UNITY_END();
+}
+
+void loop() {}
+#else
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frame_profiler_tracks_layers_and_steps);
+    RUN_TEST(test_op_counter_splits_advance_and_render);
+    RUN_TEST(test_adaptive_frame_skip_settles_on_maximum_divisor);
+    RUN_TEST(test_cost_model_predicts_frame_time);
+    return UNITY_END();
+}
+#endif
@@ -29,6 +29,7 @@
 
 #ifndef ARDUINO
 #include "renderer/pipeline/signals/src/Signals.cpp"
+#include "renderer/pipeline/signals/src/SignalProgram.cpp"
 #include "renderer/pipeline/signals/src/SignalSamplers.cpp"
 #include "renderer/pipeline/signals/src/accumulators/Accumulators.cpp"
 #include "renderer/pipeline/maths/src/TilingMaths.cpp"
@@ -39,6 +39,9 @@
 #include "renderer/pipeline/transforms/RotationTransform.h"
 #include "renderer/pipeline/transforms/TranslationTransform.h"
 #include "renderer/pipeline/transforms/ZoomTransform.h"
+#include "renderer/layer/LayerBuilder.h"
+#include "renderer/scene/Scene.h"
+#include "renderer/PolarRenderer.h"
 #define private public
 #include "renderer/pipeline/patterns/NoisePattern.h"
 #undef private
@@ -53,7 +56,13 @@
 #include "renderer/pipeline/transforms/src/RotationTransform.cpp"
 #include "renderer/pipeline/transforms/src/TranslationTransform.cpp"
 #include "renderer/pipeline/transforms/src/ZoomTransform.cpp"
+#include "renderer/pipeline/transforms/src/FlowFieldTransform.cpp"
+#include "renderer/pipeline/transforms/src/PaletteTransform.cpp"
+#include "renderer/pipeline/transforms/src/RadialKaleidoscopeTransform.cpp"
+#include "renderer/pipeline/transforms/src/TilingTransform.cpp"
+#include "renderer/pipeline/transforms/src/VortexTransform.cpp"
 #include "renderer/pipeline/signals/src/Signals.cpp"
+#include "renderer/pipeline/signals/src/SignalProgram.cpp"
 #include "renderer/pipeline/signals/src/SignalSamplers.cpp"
 #include "renderer/pipeline/signals/src/accumulators/Accumulators.cpp"
 #include "renderer/pipeline/patterns/src/Patterns.cpp"
@@ -78,6 +87,7 @@
 #include "renderer/pipeline/patterns/src/SpiralPattern.cpp"
 #include "renderer/pipeline/patterns/src/TilingPattern.cpp"
 #include "renderer/pipeline/patterns/src/TransportPattern.cpp"
+#include "renderer/pipeline/patterns/src/GrayScott.cpp"
 #include "renderer/pipeline/patterns/src/ReactionDiffusionPattern.cpp"
 #include "renderer/pipeline/patterns/src/WorleyPatterns.cpp"
 #include "renderer/pipeline/patterns/src/XORPattern.cpp"
@@ -86,6 +96,10 @@
 #include "renderer/layer/src/LayerBuilder.cpp"
 #include "renderer/scene/src/Scene.cpp"
 #include "renderer/scene/src/SceneManager.cpp"
+#include "renderer/pipeline/presets/src/Presets.cpp"
+#include "renderer/PolarRenderer.cpp"
+#include "renderer/profiling/src/FrameProfiler.cpp"
+#include "renderer/profiling/src/QualityGovernor.cpp"
 #endif
 
 using namespace PolarShader;
@@ -417,6 +431,323 @@ void test_uv_transform_chain_warps_all_payload_kinds_identically() {
     TEST_ASSERT_EQUAL_UINT16(raw(scalarV.scalar(probe)), raw(rgbSample.green()));
 }
 
+void test_uv_transform_chain_span_matches_per_pixel() {
+    RotationTransform rotation(constant(s0x16(0x2000)), true);
+    TranslationTransform translation(UVSignal([](u0x16, TimeMillis) {
+        return UV(fl::s16x16::from_raw(0x00001234), fl::s16x16::from_raw(-0x00000567));
+    }));
+    rotation.advanceFrame(u0x16(0), 0);
+    translation.advanceFrame(u0x16(0), 0);
+
+    UVLayer layer = UVLayer::fromScalar([](UV uv) {
+        return PatternNormU0x16(static_cast<uint16_t>(raw(uv.u) ^ (raw(uv.v) >> 3)));
+    });
+    layer = rotation.apply(layer);
+    layer = translation.apply(layer);
+    TEST_ASSERT_TRUE(static_cast<bool>(layer.scalarSpan));
+
+    constexpr uint16_t count = 40;
+    UV probes[count];
+    UV scratch[count];
+    for (uint16_t i = 0; i < count; ++i) {
+        probes[i] = UV(
+            fl::s16x16::from_raw(static_cast<int32_t>(i) * 0x0000061B),
+            fl::s16x16::from_raw(0x0000FFFF - static_cast<int32_t>(i) * 0x00000713)
+        );
+        scratch[i] = probes[i];
+    }
+
+    PatternNormU0x16 spanOut[count];
+    layer.scalarSpan(scratch, spanOut, count);
+    for (uint16_t i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL_UINT16(raw(layer.scalar(probes[i])), raw(spanOut[i]));
+    }
+}
+
+void test_layer_fuses_outermost_polar_run() {
+    auto makeNoise = []() {
+        auto pattern = std::make_unique<NoisePattern>();
+        pattern->state.depth = 0x12345678u;
+        return pattern;
+    };
+    // One-facet kaleidoscopes leave (angle, radius) untouched, so a fused run
+    // fed the display's own polar coordinates must match the bare pattern
+    // exactly; converting through Cartesian -> polar -> Cartesian would not.
+    CRGBPalette16 ramp;
+    for (uint8_t i = 0; i < 16; ++i) ramp.entries[i] = CRGB(i * 16, 255 - i * 16, 128);
+    Layer plain = LayerBuilder(makeNoise(), ramp, "plain").build();
+    Layer fused = LayerBuilder(makeNoise(), ramp, "fused")
+        .addTransform(KaleidoscopeTransform(1, false))
+        .addTransform(KaleidoscopeTransform(1, true))
+        .build();
+    std::unique_ptr<ColourSpanMap> plainSpan = plain.compileSpan();
+    std::unique_ptr<ColourSpanMap> fusedSpan = fused.compileSpan();
+
+    constexpr uint16_t count = SPAN_CHUNK_SIZE + 9;
+    RenderPoint points[count];
+    UV cartesian[count];
+    for (uint16_t i = 0; i < count; ++i) {
+        points[i] = RenderPoint{
+            u0x16(static_cast<uint16_t>(i * 1777u)),
+            u0x16(static_cast<uint16_t>((i * 65535u) / count)),
+            RasterPoint{}
+        };
+        cartesian[i] = polarToCartesianUV(points[i]);
+    }
+
+    CRGB expected[count];
+    CRGB actual[count];
+    (*plainSpan)(points, cartesian, expected, count);
+    (*fusedSpan)(points, cartesian, actual, count);
+    uint32_t lit = 0;
+    for (uint16_t i = 0; i < count; ++i) {
+        lit += expected[i].r + expected[i].g + expected[i].b;
+        TEST_ASSERT_EQUAL_UINT8(expected[i].r, actual[i].r);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].g, actual[i].g);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].b, actual[i].b);
+    }
+    TEST_ASSERT_TRUE(lit > 0);
+}
+
+void test_scene_sample_span_matches_per_pixel() {
+    fl::vector<std::shared_ptr<Layer> > layers;
+    layers.push_back(std::make_shared<Layer>(
+        LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "span-base")
+        .addTransform(RotationTransform(constant(s0x16(0x1000)), true))
+        .build()
+    ));
+    layers.push_back(std::make_shared<Layer>(
+        LayerBuilder(std::make_unique<NoisePattern>(NoisePattern::NoiseType::FBM), CloudColors_p, "span-top")
+        .addTransform(ZoomTransform(constant(s0x16(0x4000))))
+        .setBlendMode(BlendMode::Add)
+        .setAlpha(u0x16(0x8000))
+        .build()
+    ));
+    Scene scene(std::move(layers));
+    scene.compile();
+    scene.advanceFrame(u0x16(0), 0);
+    scene.advanceFrame(u0x16(0), 40);
+
+    // Spans longer than SPAN_CHUNK_SIZE exercise the chunked path.
+    constexpr uint16_t count = SPAN_CHUNK_SIZE * 2 + 7;
+    RenderPoint points[count];
+    for (uint16_t i = 0; i < count; ++i) {
+        points[i] = RenderPoint{
+            u0x16(static_cast<uint16_t>(i * 911u)),
+            u0x16(static_cast<uint16_t>((i * 65535u) / count)),
+            RasterPoint{}
+        };
+    }
+
+    // Precomputed Cartesian UVs (as PolarRenderer caches them) must render
+    // identically to converting on the fly.
+    UV cartesian[count];
+    for (uint16_t i = 0; i < count; ++i) {
+        cartesian[i] = polarToCartesianUV(points[i]);
+    }
+
+    CRGB spanOut[count];
+    CRGB cachedOut[count];
+    scene.sampleSpan(1, points, nullptr, spanOut, count);
+    scene.sampleSpan(0, points, cartesian, cachedOut, count);
+    for (uint16_t i = 0; i < count; ++i) {
+        CRGB expected = scene.sample(0, points[i]);
+        TEST_ASSERT_EQUAL_UINT8(expected.r, spanOut[i].r);
+        TEST_ASSERT_EQUAL_UINT8(expected.g, spanOut[i].g);
+        TEST_ASSERT_EQUAL_UINT8(expected.b, spanOut[i].b);
+        TEST_ASSERT_EQUAL_UINT8(expected.r, cachedOut[i].r);
+        TEST_ASSERT_EQUAL_UINT8(expected.g, cachedOut[i].g);
+        TEST_ASSERT_EQUAL_UINT8(expected.b, cachedOut[i].b);
+    }
+}
+
+void test_coarse_layer_upsamples_between_grid_nodes() {
+    static constexpr uint16_t width = 15;
+    static constexpr uint16_t height = 10;
+    static constexpr uint16_t count = width * height;
+    auto makeRenderer = [](uint8_t divisor) {
+        auto provider = std::make_unique<DefaultSceneProvider>([divisor]() {
+            CRGBPalette16 ramp;
+            for (uint8_t i = 0; i < 16; ++i) ramp.entries[i] = CRGB(i * 16, 255 - i * 16, 128);
+            fl::vector<std::shared_ptr<Layer> > layers;
+            auto pattern = std::make_unique<NoisePattern>(NoisePattern::NoiseType::Basic, 4, constant(500));
+            pattern->state.depth = 0x12345678u;
+            layers.push_back(std::make_shared<Layer>(
+                LayerBuilder(std::move(pattern), ramp, "coarse")
+                .setRenderDivisor(divisor)
+                .build()
+            ));
+            return std::make_unique<Scene>(std::move(layers));
+        });
+        return std::make_unique<PolarRenderer>(count, [](uint16_t i) {
+            RenderPoint point{u0x16(static_cast<uint16_t>(i * 40503u)), u0x16(static_cast<uint16_t>(i * 437u)), {}};
+            point.raster = RasterPoint{true, static_cast<uint16_t>(i % width), static_cast<uint16_t>(i / width), width, height};
+            return point;
+        }, std::move(provider));
+    };
+    auto full = makeRenderer(1);
+    auto coarse = makeRenderer(2);
+    CRGB expected[count];
+    CRGB upsampled[count];
+    full->render(expected, 1000);
+    coarse->render(upsampled, 1000);
+
+    auto at = [](const CRGB *frame, uint16_t x, uint16_t y) { return frame[y * width + x]; };
+    // Grid nodes (even cells, plus the last row) are sampled exactly.
+    for (uint16_t y = 0; y < height; y += 2) {
+        for (uint16_t x = 0; x < width; x += 2) {
+            TEST_ASSERT_EQUAL_UINT32(at(expected, x, y).r, at(upsampled, x, y).r);
+            TEST_ASSERT_EQUAL_UINT32(at(expected, x, y).g, at(upsampled, x, y).g);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(at(expected, 4, height - 1).g, at(upsampled, 4, height - 1).g);
+    // Cells between nodes are the midpoint of their neighbours (within the
+    // rounding of the blend onto the black background).
+    const CRGB left = at(expected, 6, 4);
+    const CRGB right = at(expected, 8, 4);
+    TEST_ASSERT_UINT16_WITHIN(1, (left.g + right.g) / 2, at(upsampled, 7, 4).g);
+    TEST_ASSERT_UINT16_WITHIN(1, (left.r + right.r) / 2, at(upsampled, 7, 4).r);
+}
+
+namespace {
+    std::unique_ptr<PolarRenderer> makeFrameSkipRenderer(uint16_t count, uint8_t frameDivisor, uint16_t depthSpeed) {
+        auto provider = std::make_unique<DefaultSceneProvider>([frameDivisor, depthSpeed]() {
+            CRGBPalette16 ramp;
+            for (uint8_t i = 0; i < 16; ++i) ramp.entries[i] = CRGB(i * 16, 255 - i * 16, 128);
+            auto pattern = std::make_unique<NoisePattern>(NoisePattern::NoiseType::Basic, 4, constant(depthSpeed));
+            pattern->state.depth = 0x12345678u;
+            fl::vector<std::shared_ptr<Layer> > layers;
+            layers.push_back(std::make_shared<Layer>(
+                LayerBuilder(std::move(pattern), ramp, "skip").setFrameDivisor(frameDivisor).build()
+            ));
+            return std::make_unique<Scene>(std::move(layers));
+        });
+        return std::make_unique<PolarRenderer>(count, [](uint16_t i) {
+            return RenderPoint{u0x16(static_cast<uint16_t>(i * 40503u)), u0x16(static_cast<uint16_t>(i * 851u)), {}};
+        }, std::move(provider));
+    }
+}
+
+void test_frame_skip_layer_refreshes_interleaved_pixels() {
+    constexpr uint16_t count = 77;
+    auto reference = makeFrameSkipRenderer(count, 1, 1000);
+    auto skipping = makeFrameSkipRenderer(count, 2, 1000);
+    CRGB expected[count];
+    CRGB first[count];
+    CRGB second[count];
+
+    reference->render(expected, 0);
+    skipping->render(first, 0);
+    for (uint16_t i = 0; i < count; ++i) TEST_ASSERT_EQUAL_UINT8(expected[i].g, first[i].g);
+
+    // Even pixels refresh on the next frame, odd ones keep the first frame.
+    reference->render(expected, 500);
+    skipping->render(second, 500);
+    uint16_t moved = 0;
+    for (uint16_t i = 0; i < count; ++i) {
+        const CRGB &want = i % 2 == 0 ? expected[i] : first[i];
+        TEST_ASSERT_EQUAL_UINT8(want.r, second[i].r);
+        TEST_ASSERT_EQUAL_UINT8(want.g, second[i].g);
+        if (expected[i].g != first[i].g) ++moved;
+    }
+    TEST_ASSERT_TRUE(moved > 0);
+}
+
+void test_renderer_chunks_cover_frame_once() {
+    constexpr uint16_t count = 77;
+    auto provider = std::make_unique<DefaultSceneProvider>([]() {
+        fl::vector<std::shared_ptr<Layer> > layers;
+        layers.push_back(std::make_shared<Layer>(
+            LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "chunks")
+            .addTransform(RotationTransform(constant(s0x16(0x1000)), true))
+            .build()
+        ));
+        return std::make_unique<Scene>(std::move(layers));
+    });
+    PolarRenderer renderer(count, [](uint16_t i) {
+        return RenderPoint{u0x16(static_cast<uint16_t>(i * 40503u)), u0x16(static_cast<uint16_t>(i * 851u)), {}};
+    }, std::move(provider));
+
+    CRGB expected[count];
+    renderer.render(expected, 1000);
+
+    CRGB chunked[count];
+    renderer.prepareFrame(1000);
+    const uint16_t core1Pixels = renderer.renderChunks(chunked, 1);
+    const uint16_t core0Pixels = renderer.renderChunks(chunked, 0);
+    TEST_ASSERT_EQUAL_UINT16(count, core0Pixels + core1Pixels);
+    for (uint16_t i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL_UINT8(expected[i].r, chunked[i].r);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].g, chunked[i].g);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].b, chunked[i].b);
+    }
+
+    // The next frame hands out its chunks afresh.
+    renderer.prepareFrame(1000);
+    TEST_ASSERT_EQUAL_UINT16(count, renderer.renderChunks(chunked, 0));
+}
+
+void test_noise_lattice_cache_matches_uncached_sampler() {
+    // A tiny memo forces collisions, evictions and bypasses on top of the reuse.
+    NoiseLatticeCache small(4);
+    NoiseLatticeCache large(256);
+    for (uint32_t i = 0; i < 2000; ++i) {
+        const uint32_t x = 0x400000u + i * 37u;
+        const uint32_t y = 0x400000u + (i * 7919u) % 4096u;
+        const uint32_t z = 0x400000u + i * 5u;
+        const uint16_t expected = raw(sampleNoiseTrilinear(x, y, z));
+        TEST_ASSERT_EQUAL_UINT16(expected, raw(sampleNoiseTrilinear(x, y, z, small)));
+        TEST_ASSERT_EQUAL_UINT16(expected, raw(sampleNoiseTrilinear(x, y, z, large)));
+    }
+}
+
+void test_noise_lattice_memo_only_for_layers_that_reuse_samples() {
+    Layer plain = LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "plain-noise").build();
+    TEST_ASSERT_FALSE(plain.needsPerCoreSampler());
+
+    Layer zoomed = LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "zoomed-noise")
+        .addTransform(ZoomTransform(constant(500)))
+        .build();
+    Layer folded = LayerBuilder(std::make_unique<NoisePattern>(), CloudColors_p, "folded-noise")
+        .addTransform(KaleidoscopeTransform(6, true))
+        .build();
+    TEST_ASSERT_EQUAL(POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES != 0, zoomed.needsPerCoreSampler());
+    TEST_ASSERT_EQUAL(POLAR_SHADER_NOISE_LATTICE_CACHE_ENTRIES != 0, folded.needsPerCoreSampler());
+}
+
+void test_quality_governor_holds_budget_with_hysteresis() {
+    QualityGovernor governor(1000);
+    // Frame cost proportional to quality, twice the budget at full quality.
+    auto frameAt = [](u0x16 quality) { return static_cast<uint32_t>(raw(quality)) * 2000u / U0X16_MAX; };
+
+    for (uint8_t i = 0; i < QualityGovernor::LOWER_AFTER_FRAMES - 1; ++i) governor.recordFrame(2000);
+    TEST_ASSERT_EQUAL_UINT16(U0X16_MAX, raw(governor.quality()));
+    governor.recordFrame(2000);
+    const uint16_t settled = raw(governor.quality());
+    TEST_ASSERT_EQUAL_UINT16(U0X16_MAX / 2, settled);
+
+    // On budget: no further moves either way.
+    for (uint8_t i = 0; i < 100; ++i) governor.recordFrame(frameAt(governor.quality()));
+    TEST_ASSERT_EQUAL_UINT16(settled, raw(governor.quality()));
+
+    // Dips below the raise threshold must be consecutive to count.
+    for (uint8_t i = 0; i < QualityGovernor::RAISE_AFTER_FRAMES / 2; ++i) governor.recordFrame(100);
+    for (uint8_t i = 0; i < 8; ++i) governor.recordFrame(1000);
+    for (uint8_t i = 0; i < QualityGovernor::RAISE_AFTER_FRAMES / 2; ++i) governor.recordFrame(100);
+    TEST_ASSERT_EQUAL_UINT16(settled, raw(governor.quality()));
+
+    // Sustained headroom raises quality one step at a time.
+    for (uint8_t i = 0; i < QualityGovernor::RAISE_AFTER_FRAMES; ++i) governor.recordFrame(100);
+    TEST_ASSERT_EQUAL_UINT16(settled + QualityGovernor::RAISE_STEP, raw(governor.quality()));
+
+    // Hopeless overruns stop at the floor.
+    for (uint8_t i = 0; i < 64; ++i) governor.recordFrame(100000);
+    TEST_ASSERT_EQUAL_UINT16(POLAR_SHADER_QUALITY_FLOOR, raw(governor.quality()));
+
+    governor.reset();
+    TEST_ASSERT_EQUAL_UINT16(U0X16_MAX, raw(governor.quality()));
+}
+
 /** @brief Verify easing functions loop if period > 0. */
 void test_easing_period_looping() {
     // Linear signal looping every 500ms
@@ -672,6 +1003,13 @@ void setup() {
     RUN_TEST(test_zoom_transform_sine_varies_over_time);
     RUN_TEST(test_kaleidoscope_translation_mirrors_at_unit_uv_boundary);
     RUN_TEST(test_uv_transform_chain_warps_all_payload_kinds_identically);
+    RUN_TEST(test_uv_transform_chain_span_matches_per_pixel);
+    RUN_TEST(test_layer_fuses_outermost_polar_run);
+    RUN_TEST(test_scene_sample_span_matches_per_pixel);
+    RUN_TEST(test_renderer_chunks_cover_frame_once);
+    RUN_TEST(test_noise_lattice_cache_matches_uncached_sampler);
+    RUN_TEST(test_noise_lattice_memo_only_for_layers_that_reuse_samples);
+    RUN_TEST(test_quality_governor_holds_budget_with_hysteresis);
     RUN_TEST(test_easing_period_looping);
     RUN_TEST(test_periodic_signal_uses_elapsed_time);
     RUN_TEST(test_aperiodic_reset_wraps_time);
@@ -688,6 +1026,8 @@ void setup() {
     RUN_TEST(test_s0x16_u0x16_mapping_helpers);
     RUN_TEST(test_rotation_accumulation);
     RUN_TEST(test_noise_pattern_depth_speed_wraps_in_six_hours);
+    RUN_TEST(test_coarse_layer_upsamples_between_grid_nodes);
+    RUN_TEST(test_frame_skip_layer_refreshes_interleaved_pixels);
     UNITY_END();
 }
 
@@ -717,6 +1057,13 @@ int main(int argc, char **argv) {
     RUN_TEST(test_zoom_transform_sine_varies_over_time);
     RUN_TEST(test_kaleidoscope_translation_mirrors_at_unit_uv_boundary);
     RUN_TEST(test_uv_transform_chain_warps_all_payload_kinds_identically);
+    RUN_TEST(test_uv_transform_chain_span_matches_per_pixel);
+    RUN_TEST(test_layer_fuses_outermost_polar_run);
+    RUN_TEST(test_scene_sample_span_matches_per_pixel);
+    RUN_TEST(test_renderer_chunks_cover_frame_once);
+    RUN_TEST(test_noise_lattice_cache_matches_uncached_sampler);
+    RUN_TEST(test_noise_lattice_memo_only_for_layers_that_reuse_samples);
+    RUN_TEST(test_quality_governor_holds_budget_with_hysteresis);
     RUN_TEST(test_easing_period_looping);
     RUN_TEST(test_periodic_signal_uses_elapsed_time);
     RUN_TEST(test_aperiodic_reset_wraps_time);
@@ -733,6 +1080,8 @@ int main(int argc, char **argv) {
     RUN_TEST(test_s0x16_u0x16_mapping_helpers);
     RUN_TEST(test_rotation_accumulation);
     RUN_TEST(test_noise_pattern_depth_speed_wraps_in_six_hours);
+    RUN_TEST(test_coarse_layer_upsamples_between_grid_nodes);
+    RUN_TEST(test_frame_skip_layer_refreshes_interleaved_pixels);
     return UNITY_END();
 }
 #endif
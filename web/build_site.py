@@ -81,6 +81,9 @@ EXCLUDED_STAGED_SOURCE_PATHS = {
     # native_psc_render env; exclude from the WASM unity build so it never links
     # a second main or pulls in native-only headers.
     "tools/psc_render.cpp",
+    # Native-only render benchmark: ships its own main(). Built only by the
+    # native_bench env; exclude from the WASM unity build.
+    "tools/native_bench.cpp",
 }
 
 
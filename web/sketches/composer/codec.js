@@ -1,11 +1,15 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (C) 2025 Pierre Thomain
 //
-// PSC v1 encoder/decoder. Mirrors src/composer/SceneCodec.cpp's wire
-// format. The byte layout is the contract — drift is caught by the
-// cross-implementation golden fixture in test/test_composer.
+// PSC v1/v2 encoder/decoder. Mirrors src/composer/SceneCodec.cpp's wire
+// format. v1 carries one layer as { paletteId, pattern, transforms }; v2
+// carries { layers: [...] }, each layer adding alpha (raw u0x16) and
+// blendMode (index into BLEND_MODES), bottom layer first. The byte layout
+// is the contract — drift is caught by the cross-implementation golden
+// fixture in test/test_composer.
 
 import {
+    BLEND_MODES, PSC_MAX_LAYERS,
     PALETTES, PATTERNS, PATTERN_BY_TAG,
     TRANSFORMS, TRANSFORM_BY_TAG,
     SIGNALS, SIGNAL_BY_TAG,
@@ -14,6 +18,7 @@ import {
 
 const MAGIC = [0x50, 0x53, 0x43, 0x00];   // "PSC\0"
 const VERSION = 0x01;
+const LAYERED_VERSION = 0x02;
 const MAX_SIGNAL_RECURSION_DEPTH = 64;
 
 // ─────────────────────────────────────────────────────────────────────
@@ -332,23 +337,73 @@ function readTransform(r, version) {
 // Top-level
 // ─────────────────────────────────────────────────────────────────────
 
-export function encodeScene(scene, { version = VERSION } = {}) {
-    if (version !== VERSION) {
+export function isLayeredScene(scene) {
+    return Array.isArray(scene?.layers);
+}
+
+function writeLayerBody(w, layer, version) {
+    if (!PALETTES.find(p => p.id === layer.paletteId)) {
+        throw new Error(`unknown palette id ${layer.paletteId}`);
+    }
+    w.u8(layer.paletteId);
+    writePattern(w, layer.pattern, version);
+    const tfms = layer.transforms ?? [];
+    assertTransformCompatible(layer.pattern, tfms);
+    if (tfms.length > 255) throw new Error('too many transforms (max 255)');
+    w.u8(tfms.length);
+    for (const t of tfms) writeTransform(w, t, version);
+}
+
+function readLayerBody(r, version) {
+    const paletteId = r.u8();
+    if (!PALETTES.find(p => p.id === paletteId)) {
+        throw new Error(`unknown palette id ${paletteId}`);
+    }
+    const pattern = readPattern(r, version);
+    const transformCount = r.u8();
+    const transforms = [];
+    for (let i = 0; i < transformCount; ++i) transforms.push(readTransform(r, version));
+    assertTransformCompatible(pattern, transforms);
+    return { paletteId, pattern, transforms };
+}
+
+function checkLayerCount(count) {
+    if (count < 1 || count > PSC_MAX_LAYERS) {
+        throw new Error(`layer count ${count} outside 1..${PSC_MAX_LAYERS}`);
+    }
+}
+
+// Single-layer scenes encode as v1 unless { version: 2 } is passed;
+// { layers } scenes always need v2.
+export function encodeScene(scene, { version = isLayeredScene(scene) ? LAYERED_VERSION : VERSION } = {}) {
+    if (version !== VERSION && version !== LAYERED_VERSION) {
         throw new Error(`unsupported PSC encode version ${version}`);
     }
     const w = new ByteWriter();
     for (const b of MAGIC) w.u8(b);
     w.u8(version);
-    if (!PALETTES.find(p => p.id === scene.paletteId)) {
-        throw new Error(`unknown palette id ${scene.paletteId}`);
+    if (version === VERSION) {
+        if (isLayeredScene(scene)) throw new Error('PSC v1 holds a single layer; encode layers as v2');
+        writeLayerBody(w, scene, version);
+        return w.toUint8Array();
+    }
+
+    const layers = isLayeredScene(scene) ? scene.layers : [scene];
+    checkLayerCount(layers.length);
+    w.u8(layers.length);
+    for (const layer of layers) {
+        const alpha = layer.alpha ?? 0xFFFF;
+        const blendMode = layer.blendMode ?? 0;
+        if (!Number.isInteger(alpha) || alpha < 0 || alpha > 0xFFFF) {
+            throw new Error(`layer alpha ${alpha} outside 0..65535`);
+        }
+        if (!Number.isInteger(blendMode) || blendMode < 0 || blendMode >= BLEND_MODES.length) {
+            throw new Error(`bad blend mode ${blendMode}`);
+        }
+        w.u16(alpha);
+        w.u8(blendMode);
+        writeLayerBody(w, layer, version);
     }
-    w.u8(scene.paletteId);
-    writePattern(w, scene.pattern, version);
-    const tfms = scene.transforms ?? [];
-    assertTransformCompatible(scene.pattern, tfms);
-    if (tfms.length > 255) throw new Error('too many transforms (max 255)');
-    w.u8(tfms.length);
-    for (const t of tfms) writeTransform(w, t, version);
     return w.toUint8Array();
 }
 
@@ -358,16 +413,24 @@ export function decodeScene(bytes) {
         if (r.u8() !== MAGIC[i]) throw new Error('bad PSC magic');
     }
     const version = r.u8();
-    if (version !== VERSION) throw new Error(`unsupported PSC version ${version}`);
-    const paletteId = r.u8();
-    if (!PALETTES.find(p => p.id === paletteId)) {
-        throw new Error(`unknown palette id ${paletteId}`);
+    if (version !== VERSION && version !== LAYERED_VERSION) {
+        throw new Error(`unsupported PSC version ${version}`);
+    }
+    if (version === VERSION) {
+        const scene = readLayerBody(r, version);
+        r.expectEnd('scene');
+        return scene;
+    }
+
+    const layerCount = r.u8();
+    checkLayerCount(layerCount);
+    const layers = [];
+    for (let i = 0; i < layerCount; ++i) {
+        const alpha = r.u16();
+        const blendMode = r.u8();
+        if (blendMode >= BLEND_MODES.length) throw new Error(`bad blend mode ${blendMode}`);
+        layers.push({ alpha, blendMode, ...readLayerBody(r, version) });
     }
-    const pattern = readPattern(r, version);
-    const transformCount = r.u8();
-    const transforms = [];
-    for (let i = 0; i < transformCount; ++i) transforms.push(readTransform(r, version));
     r.expectEnd('scene');
-    assertTransformCompatible(pattern, transforms);
-    return { paletteId, pattern, transforms };
+    return { layers };
 }
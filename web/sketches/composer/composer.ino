@@ -31,6 +31,8 @@
 #include "display/WebDisplayGeometry.h"
 #include "display/WebFastLedDisplay.h"
 #include "composer/SceneCodec.h"
+#include "renderer/profiling/CostModel.h"
+#include "renderer/profiling/FrameProfiler.h"
 
 using namespace PolarShader;
 
@@ -213,6 +215,18 @@ namespace {
         }
     }
 
+#if POLAR_SHADER_COUNT_OPS
+    uint16_t activeLedCount() {
+        if (activeDisplay == DISPLAY_ROUND && roundDisplay) return roundDisplay->nbLeds();
+        if (activeDisplay == DISPLAY_FABRIC_32X8 && fabric32x8Display) return fabric32x8Display->nbLeds();
+        if (activeDisplay == DISPLAY_SMARTMATRIX && smartMatrixDisplay) return smartMatrixDisplay->nbLeds();
+        if (activeDisplay == DISPLAY_FIBONACCI && fibonacciDisplay) return fibonacciDisplay->nbLeds();
+        if (activeDisplay == DISPLAY_LOADED && loadedDisplay) return loadedDisplay->nbLeds();
+        if (fabricDisplay) return fabricDisplay->nbLeds();
+        return 0;
+    }
+#endif
+
     // Decode `lastValidBlob` and push it through the active display's
     // renderer. No-op if the blob is empty (pre-first-apply state).
     void replayBlob(uint32_t seq) {
@@ -351,6 +365,52 @@ uint8_t composer_get_display() {
     return activeDisplay;
 }
 
+// Frame profiler report for the last completed window, one component per
+// line ("stage name[#step] min mean max unit"). Empty unless the sketch is
+// built with -DPOLAR_SHADER_PROFILE=1. Read with UTF8ToString(); the buffer
+// is overwritten by the next call.
+EMSCRIPTEN_KEEPALIVE
+const char *composer_profile_report() {
+    static char report[4096];
+#if POLAR_SHADER_PROFILE
+    FrameProfiler::formatReport(report, sizeof(report));
+#else
+    report[0] = '\0';
+#endif
+    return report;
+}
+
+EMSCRIPTEN_KEEPALIVE
+void composer_profile_reset() {
+#if POLAR_SHADER_PROFILE
+    FrameProfiler::reset();
+#endif
+}
+
+// Predicted frame time on each supported board for the scene and display
+// as rendered since the last call, one line per board ("env frame_ms fps",
+// suffixed " over budget" past POLAR_SHADER_FRAME_BUDGET_MS), then restarts
+// the count. Empty unless built with -DPOLAR_SHADER_COUNT_OPS=1 or before
+// any frame has rendered. Read with UTF8ToString().
+EMSCRIPTEN_KEEPALIVE
+const char *composer_predict_report() {
+    static char report[512];
+    report[0] = '\0';
+#if POLAR_SHADER_COUNT_OPS
+    const uint32_t frames = OpCounter::frames();
+    if (frames > 0) {
+        formatPredictionReport(
+            OpCounter::counts(OpStage::Advance).perFrame(frames),
+            OpCounter::counts(OpStage::Render).perFrame(frames),
+            activeLedCount(),
+            report,
+            sizeof(report));
+    }
+    OpCounter::reset();
+#endif
+    return report;
+}
+
 }  // extern "C"
 
 // ─────────────────────────────────────────────────────────────────────
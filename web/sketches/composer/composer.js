@@ -13,7 +13,7 @@ import {
     PALETTES, PATTERNS, TRANSFORMS, PF_PRESETS, DEFAULT_SCENE, DEFAULT_SIGNAL,
     DEFAULT_PALETTE_TRANSFORM,
 } from './schema.js';
-import { encodeScene, decodeScene } from './codec.js';
+import { encodeScene, decodeScene, isLayeredScene } from './codec.js';
 import { decodePds } from './pds-codec.js';
 import { renderSignalSlot } from './signal-editor.js';
 
@@ -69,7 +69,8 @@ function readBootSceneState() {
         const saved = raw ? JSON.parse(raw) : null;
         if (saved?.verified !== true || !Array.isArray(saved.bytes)) return null;
         const bytes = new Uint8Array(saved.bytes);
-        return { bytes, scene: decodeScene(bytes) };
+        const scene = decodeScene(bytes);
+        return isLayeredScene(scene) ? null : { bytes, scene };
     } catch {
         return null;
     }
@@ -444,7 +445,7 @@ function timestampForFilename(date = new Date()) {
 }
 
 function pscDownloadFilename(scene) {
-    const patternId = scene.pattern?.id ?? '';
+    const patternId = (scene.pattern ?? scene.layers?.[0]?.pattern)?.id ?? '';
     const patternName = PATTERNS[patternId]?.label ?? patternId;
     const prefix = slugForFilename(patternName) || slugForFilename(patternId) || 'scene';
     return `${prefix}-${timestampForFilename()}.psc`;
@@ -906,6 +907,9 @@ async function loadPlaylistScene(name, { activate = false } = {}) {
     try {
         const bytes = await fetchPlaylistFileBytes(name);
         const decoded = decodeScene(bytes);
+        // The editor works on one layer; layered (PSC v2) scenes still play
+        // from the playlist but cannot be opened here.
+        if (isLayeredScene(decoded)) throw new Error(`${name} has ${decoded.layers.length} layers; the editor opens single-layer scenes only`);
         setPlaylistBaseline(name, bytes);
         state.playlistActiveName = activate ? name : '';
         sceneStore.setScene(decoded, {
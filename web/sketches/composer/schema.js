@@ -1,7 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (C) 2025 Pierre Thomain
 //
-// PSC v1 schema — mirrors src/composer/SceneCodec.cpp byte-for-byte.
+// PSC v1/v2 schema — mirrors src/composer/SceneCodec.cpp byte-for-byte.
 // Drift between this file and the C++ tag tables is caught by the
 // cross-implementation golden fixture in test/test_composer.
 
@@ -26,6 +26,11 @@ export const PALETTES = [
     { id: 3, name: 'Forest' },
 ];
 
+// PSC v2 layer compositing: blend modes by wire index (BlendMode in
+// Layer.h) and the layer cap (POLAR_SHADER_PSC_MAX_LAYERS default).
+export const BLEND_MODES = ['Normal', 'Add', 'Multiply', 'Screen'];
+export const PSC_MAX_LAYERS = 4;
+
 export const LOOP_MODES        = ['RESET', 'SATURATE'];
 export const NOISE_TYPES       = ['Basic', 'FBM', 'Turbulence', 'Ridged'];
 export const TRANSPORT_MODES   = [
@@ -43,6 +43,37 @@ const SIMPLE_FIXTURE = [
     0x00, 0x02, 0x00, 0xc8, 0x00,
 ];
 
+// SIMPLE_SCENE under a Screen layer of turbulence noise at half alpha.
+const LAYERED_SCENE = {
+    layers: [
+        { alpha: 0xFFFF, blendMode: 0, ...SIMPLE_SCENE },
+        {
+            alpha: 0x8000,
+            blendMode: 3,
+            paletteId: 2,
+            pattern: { id: 'noiseTurbulence', config: {}, signals: {} },
+            transforms: [],
+        },
+    ],
+};
+
+const LAYERED_FIXTURE = [
+    0x50, 0x53, 0x43, 0x00,
+    0x02,
+    0x02,
+    0xff, 0xff, 0x00,
+    0x00,
+    0x00, 0x05, 0x00,
+    0x00, 0x02, 0x00, 0x26, 0x02,
+    0x01,
+    0x02, 0x05, 0x00,
+    0x00, 0x02, 0x00, 0xc8, 0x00,
+    0x00, 0x80, 0x03,
+    0x02,
+    0x02, 0x00, 0x00,
+    0x00,
+];
+
 const LEGACY_PALETTE_GLOW_FIXTURE = [
     0x50, 0x53, 0x43, 0x00,
     0x01,
@@ -167,6 +198,49 @@ test('decodeScene reads PSC v1 golden bytes', () => {
     assert.equal(scene.transforms[0].signals.scale.params.permille, 200);
 });
 
+test('encodeScene emits exact PSC v2 layered golden bytes', () => {
+    assert.deepEqual(Array.from(encodeScene(LAYERED_SCENE)), LAYERED_FIXTURE);
+});
+
+test('decodeScene reads PSC v2 layers bottom first', () => {
+    const scene = decodeScene(bytes(LAYERED_FIXTURE));
+    assert.equal(scene.layers.length, 2);
+    assert.equal(scene.layers[0].alpha, 0xFFFF);
+    assert.equal(scene.layers[0].blendMode, 0);
+    assert.equal(scene.layers[0].pattern.id, 'noiseBasic');
+    assert.equal(scene.layers[0].transforms[0].id, 'zoom');
+    assert.equal(scene.layers[1].alpha, 0x8000);
+    assert.equal(scene.layers[1].blendMode, 3);
+    assert.equal(scene.layers[1].paletteId, 2);
+    assert.equal(scene.layers[1].pattern.id, 'noiseTurbulence');
+    assertStableRoundTrip(scene, 'layered scene');
+});
+
+test('single-layer scenes stay v1 unless v2 is requested', () => {
+    const v2 = encodeScene(SIMPLE_SCENE, { version: 2 });
+    assert.equal(v2[4], 2);
+    assert.deepEqual(decodeScene(v2).layers[0].pattern, decodeScene(bytes(SIMPLE_FIXTURE)).pattern);
+    assertThrowsMessage(() => encodeScene(LAYERED_SCENE, { version: 1 }), /PSC v1 holds a single layer/);
+});
+
+test('layered scenes reject bad layer counts and blend modes', () => {
+    assertThrowsMessage(() => encodeScene({ layers: [] }), /layer count 0 outside 1\.\.4/);
+    assertThrowsMessage(
+        () => encodeScene({ layers: Array(5).fill(SIMPLE_SCENE) }),
+        /layer count 5 outside 1\.\.4/,
+    );
+    assertThrowsMessage(
+        () => encodeScene({ layers: [{ ...SIMPLE_SCENE, blendMode: 4 }] }),
+        /bad blend mode 4/,
+    );
+
+    const noLayers = bytes([0x50, 0x53, 0x43, 0x00, 0x02, 0x00]);
+    assertThrowsMessage(() => decodeScene(noLayers), /layer count 0 outside 1\.\.4/);
+    const badBlend = bytes(LAYERED_FIXTURE);
+    badBlend[8] = 0x04;
+    assertThrowsMessage(() => decodeScene(badBlend), /bad blend mode 4/);
+});
+
 test('schema tags are unique', () => {
     assertUniqueTags(PATTERNS, 'pattern');
     assertUniqueTags(TRANSFORMS, 'transform');
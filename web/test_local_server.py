@@ -158,6 +158,36 @@ class PscValidationTest(unittest.TestCase):
         with self.assertRaisesRegex(psc_v1.PscValidationError, "below min 1"):
             psc_v1.validate_psc_scene(payload)
 
+    def test_validator_accepts_layered_scene(self) -> None:
+        # Same bytes as LAYERED_FIXTURE in web/test_codec.mjs.
+        payload = bytes([
+            0x50, 0x53, 0x43, 0x00,
+            0x02,
+            0x02,
+            0xFF, 0xFF, 0x00,
+            0x00,
+            0x00, 0x05, 0x00,
+            0x00, 0x02, 0x00, 0x26, 0x02,
+            0x01,
+            0x02, 0x05, 0x00,
+            0x00, 0x02, 0x00, 0xC8, 0x00,
+            0x00, 0x80, 0x03,
+            0x02,
+            0x02, 0x00, 0x00,
+            0x00,
+        ])
+        info = psc_v1.validate_psc_scene(payload)
+        self.assertEqual(info.pattern_tag, 0x00)
+        self.assertEqual(info.layer_count, 2)
+        self.assertEqual(psc_v1.raw_pattern_tag(payload), 0x00)
+
+        bad_blend = bytearray(payload)
+        bad_blend[8] = 0x04
+        with self.assertRaisesRegex(psc_v1.PscValidationError, "bad blend mode 4"):
+            psc_v1.validate_psc_scene(bytes(bad_blend))
+        with self.assertRaisesRegex(psc_v1.PscValidationError, r"layer count 0 outside 1\.\.4"):
+            psc_v1.validate_psc_scene(bytes([0x50, 0x53, 0x43, 0x00, 0x02, 0x00]))
+
     def test_validator_rejects_legacy_palette_transform(self) -> None:
         tag, error = local_server._psc_pattern_tag(LEGACY_PALETTE_TRANSFORM_PSC)
         self.assertEqual(tag, 0)